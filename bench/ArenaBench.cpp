@@ -0,0 +1,57 @@
+/*
+ * onyx::arena::json built inside a request arena against nlohmann::json on the heap: building,
+ * serializing and dropping a document per request. Run with make bench, the optional argument
+ * is the number of iterations
+ */
+
+#include "Bench.h"
+#include "../framework/arena/Arena.h"
+
+namespace {
+
+    template<typename Json>
+    Json build(size_t size) {
+        Json document;
+        Json & items = document["items"];
+        for (size_t i = 0; i < size; i++) {
+            Json item;
+            item["id"] = i;
+            item["name"] = "item";
+            item["price"] = i * 0.5;
+            item["tags"].push_back(1);
+            item["tags"].push_back(2);
+            items.push_back(std::move(item));
+        }
+        document["count"] = size;
+        return document;
+    }
+
+    void compare(size_t size, size_t iterations) {
+        printf("document of %zu items\n", size);
+        onyx::arena::Arena arena;
+        double before = bench::run("  build and drop, nlohmann::json", iterations, [size]() {
+            bench::keep(build<nlohmann::json>(size));
+        });
+        double after = bench::run("  build and drop, onyx::arena::json", iterations, [size, &arena]() {
+            onyx::arena::Arena::Scope scope(arena);
+            bench::keep(build<onyx::arena::json>(size));
+        });
+        printf("  speedup %.2fx\n", before / after);
+        before = bench::run("  build, dump and drop, nlohmann::json", iterations, [size]() {
+            bench::keep(build<nlohmann::json>(size).dump());
+        });
+        after = bench::run("  build, dump and drop, onyx::arena::json", iterations, [size, &arena]() {
+            onyx::arena::Arena::Scope scope(arena);
+            bench::keep(build<onyx::arena::json>(size).dump());
+        });
+        printf("  speedup %.2fx\n", before / after);
+    }
+}
+
+int main(int argc, char ** argv) {
+    size_t iterations = bench::iterations(argc, argv, 20000);
+    compare(10, iterations);
+    compare(1000, iterations / 100);
+    compare(100000, iterations / 4000 + 1);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace bench {
+
+    /*
+     * iterations given on the command line, or the default of the benchmark
+     */
+    inline size_t iterations(int argc, char ** argv, size_t fallback) {
+        return argc > 1 ? strtoul(argv[1], nullptr, 10) : fallback;
+    }
+
+    /*
+     * keeps the compiler from dropping the computation of value
+     */
+    template<typename T>
+    inline void keep(const T & value) {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+
+    /*
+     * runs function iterations times after a tenth as many warm-up runs and prints the
+     * time per run. Returns the nanoseconds per run
+     */
+    template<typename Function>
+    double run(const std::string & name, size_t iterations, Function function) {
+        for (size_t i = 0; i < iterations / 10; i++)
+            function();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            function();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+        printf("%-48s %12.1f ns/op\n", name.c_str(), ns);
+        return ns;
+    }
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * encoding and decoding of a response body as JSON, MessagePack and CBOR, with the nlohmann
+ * writers JsonResponse uses and the readers of ONObject::getJson. Run with make bench, the
+ * optional argument is the number of iterations
+ */
+
+#include "Bench.h"
+#include "../framework/common/json/json.hpp"
+
+namespace {
+
+    nlohmann::json document(size_t size) {
+        nlohmann::json body;
+        nlohmann::json & items = body["items"];
+        for (size_t i = 0; i < size; i++) {
+            items.push_back({
+                {"id", i},
+                {"name", "item " + std::to_string(i)},
+                {"price", i * 0.25},
+                {"available", i % 2 == 0},
+                {"tags", {"red", "green"}}
+            });
+        }
+        body["count"] = size;
+        return body;
+    }
+
+    std::string encode(const nlohmann::json & body, const std::string & encoding) {
+        std::string out;
+        nlohmann::detail::output_adapter_t<char> output = std::make_shared<nlohmann::detail::output_string_adapter<char>>(out);
+        if (encoding == "MessagePack")
+            nlohmann::detail::binary_writer<nlohmann::json, char>(output).write_msgpack(body);
+        else if (encoding == "CBOR")
+            nlohmann::detail::binary_writer<nlohmann::json, char>(output).write_cbor(body);
+        else
+            nlohmann::detail::serializer<nlohmann::json>(output, ' ').dump(body, false, false, 0);
+        return out;
+    }
+
+    nlohmann::json decode(const std::string & input, const std::string & encoding) {
+        if (encoding == "MessagePack")
+            return nlohmann::json::from_msgpack(input);
+        if (encoding == "CBOR")
+            return nlohmann::json::from_cbor(input);
+        return nlohmann::json::parse(input);
+    }
+
+    void compare(size_t size, size_t iterations) {
+        printf("document of %zu items\n", size);
+        nlohmann::json body = document(size);
+        for (const std::string encoding : {"JSON", "MessagePack", "CBOR"}) {
+            std::string encoded = encode(body, encoding);
+            if (decode(encoded, encoding) != body) {
+                fprintf(stderr, "%s doesn't round-trip\n", encoding.c_str());
+                exit(EXIT_FAILURE);
+            }
+            printf("  %s: %zu bytes\n", encoding.c_str(), encoded.size());
+            bench::run("    encode", iterations, [&body, &encoding]() {
+                bench::keep(encode(body, encoding));
+            });
+            bench::run("    decode", iterations, [&encoded, &encoding]() {
+                bench::keep(decode(encoded, encoding));
+            });
+        }
+    }
+}
+
+int main(int argc, char ** argv) {
+    size_t iterations = bench::iterations(argc, argv, 20000);
+    compare(10, iterations);
+    compare(1000, iterations / 100);
+    return 0;
+}
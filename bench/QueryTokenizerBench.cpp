@@ -0,0 +1,76 @@
+/*
+ * onyx::ParamCollection, built on onyx::param::tokenize_query, against the strtok_r parser it
+ * replaced. Run with make bench, the optional argument is the number of iterations
+ */
+
+#include "Bench.h"
+#include "../framework/param/Param.h"
+#include "../framework/param/QueryTokenizer.h"
+#include <map>
+#include <vector>
+#include <memory>
+#include <cstring>
+
+namespace {
+
+    /*
+     * the parser of ParamCollection and Request::parse_form_params before tokenize_query, it
+     * didn't decode the keys and values
+     */
+    std::map<std::string, std::string> parseStrtok(const std::string & params) {
+        std::map<std::string, std::string> result;
+        std::unique_ptr<char[] > buffer(new char[params.size() + 1]);
+        memset(buffer.get(), '\0', params.size() + 1);
+        strncpy(buffer.get(), params.c_str(), params.size() + 1);
+        char *savep_tr;
+        char *token = strtok_r(buffer.get(), "&", &savep_tr);
+        std::vector<std::string> tmp;
+        while (token != NULL) {
+            tmp.push_back(token);
+            token = strtok_r(NULL, "&", &savep_tr);
+        }
+        for (size_t i = 0; i < tmp.size(); i++) {
+            std::string value = tmp[i];
+            size_t sep = value.find("=");
+            std::string key, val;
+            key = value.substr(0, sep);
+            val = value.substr(sep + 1, value.size() - sep - 1);
+            result.insert(std::pair<std::string, std::string>(key, val));
+        }
+        return result;
+    }
+
+    void compare(const std::string & name, const std::string & input, size_t iterations) {
+        printf("%s: %zu bytes\n", name.c_str(), input.size());
+        double before = bench::run("  strtok_r parser", iterations, [&input]() {
+            bench::keep(parseStrtok(input));
+        });
+        double after = bench::run("  ParamCollection", iterations, [&input]() {
+            onyx::ParamCollection params(input);
+            bench::keep(params);
+        });
+        bench::run("  tokenize_query alone", iterations, [&input]() {
+            size_t pairs = 0;
+            onyx::param::tokenize_query(input, [&pairs](const onyx::param::QueryPair &) {
+                pairs++;
+            });
+            bench::keep(pairs);
+        });
+        printf("  speedup %.2fx\n", before / after);
+    }
+}
+
+int main(int argc, char ** argv) {
+    size_t iterations = bench::iterations(argc, argv, 200000);
+
+    compare("short query", "page=2&sort=name&order=asc&q=onyx&limit=20", iterations);
+
+    std::string form;
+    for (int i = 0; i < 100; i++)
+        form += "field" + std::to_string(i) + "=some+value%20with%2Fescapes&";
+    compare("urlencoded form, 100 fields", form, iterations / 20);
+
+    std::string text = "comment=" + std::string(16384, 'x');
+    compare("one 16 KB field", text, iterations / 20);
+    return 0;
+}
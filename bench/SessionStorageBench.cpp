@@ -0,0 +1,116 @@
+/*
+ * throughput of the built-in session storages and of the session cache under contention: every thread
+ * fetches sessions (9 of 10 operations) and logs in or out, on 1 to 8 threads. Each figure is the best
+ * of 3 runs, shards can only pay off with as many cores as threads. Run with make bench, the optional
+ * argument is the number of operations per thread
+ */
+
+#include "Bench.h"
+#include "../framework/session/MemorySessionStorage.h"
+#include "../framework/session/FileSessionStorage.h"
+#include "../framework/session/SessionCache.h"
+#include <thread>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <unistd.h>
+
+namespace {
+
+    const size_t SESSIONS = 10000;
+    const int RUNS = 3;
+
+    std::string sessionId(size_t i) {
+        return "session-" + std::to_string(i) + "-0123456789abcdef";
+    }
+
+    /*
+     * operation(id, kind) with kind 0 for a logout, 1 for a login, a lookup otherwise
+     */
+    template<typename Operation>
+    void measure(const std::string & name, size_t operations, Operation operation) {
+        std::vector<std::string> ids;
+        for (size_t i = 0; i < SESSIONS; i++)
+            ids.push_back(sessionId(i));
+
+        printf("%s\n", name.c_str());
+        for (size_t threads : {1, 2, 4, 8}) {
+            double best = 0;
+            for (int run = 0; run < RUNS; run++) {
+                std::vector<std::thread> workers;
+                auto start = std::chrono::steady_clock::now();
+                for (size_t t = 0; t < threads; t++) {
+                    workers.emplace_back([&operation, &ids, operations, t, run]() {
+                        std::mt19937 rng(t * RUNS + run);
+                        size_t found = 0;
+                        for (size_t i = 0; i < operations; i++)
+                            found += operation(ids[rng() % ids.size()], rng() % 20);
+                        bench::keep(found);
+                    });
+                }
+                for (auto & worker : workers)
+                    worker.join();
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = std::max(best, threads * operations / seconds);
+            }
+            std::string label = "  " + std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+            printf("%-48s %12.0f ops/s\n", label.c_str(), best);
+        }
+    }
+
+    void measureStorage(const std::string & name, onyx::ISessionStorage & storage, size_t operations) {
+        storage.clearAllSession();
+        for (size_t i = 0; i < SESSIONS; i++)
+            storage.createSession(sessionId(i), "token", onyx::session::User("user", "admin,editor"));
+        measure(name, operations, [&storage](const std::string & id, unsigned kind) -> size_t {
+            if (kind == 0) {
+                storage.removeSession(id);
+                return 0;
+            }
+            if (kind == 1)
+                return storage.createSession(id, "token", onyx::session::User("user", "admin,editor"));
+            std::unique_ptr<onyx::Session> session(storage.fetchSession(id));
+            return session != nullptr;
+        });
+    }
+
+    void measureCache(const std::string & name, onyx::SessionCache & cache, size_t operations) {
+        std::shared_ptr<const onyx::Session> session = std::make_shared<const onyx::Session>("id", "token", onyx::session::User("user", "admin,editor"));
+        for (size_t i = 0; i < SESSIONS; i++)
+            cache.put(sessionId(i), session);
+        measure(name, operations, [&cache, &session](const std::string & id, unsigned kind) -> size_t {
+            if (kind == 0) {
+                cache.remove(id);
+                return 0;
+            }
+            if (kind == 1) {
+                cache.put(id, session);
+                return 1;
+            }
+            return cache.get(id) != nullptr;
+        });
+    }
+}
+
+int main(int argc, char ** argv) {
+    size_t operations = bench::iterations(argc, argv, 200000);
+    printf("%u cores\n", std::thread::hardware_concurrency());
+
+    onyx::SessionCache single_cache(SESSIONS * 2, std::chrono::seconds(3600), 1);
+    measureCache("SessionCache, 1 shard", single_cache, operations);
+    onyx::SessionCache sharded_cache(SESSIONS * 2, std::chrono::seconds(3600), 16);
+    measureCache("SessionCache, 16 shards", sharded_cache, operations);
+
+    onyx::MemorySessionStorage single(std::chrono::seconds(3600), 1);
+    measureStorage("MemorySessionStorage, 1 shard", single, operations);
+    onyx::MemorySessionStorage sharded(std::chrono::seconds(3600), 16);
+    measureStorage("MemorySessionStorage, 16 shards", sharded, operations);
+
+    std::string path = "/tmp/onyx-bench-sessions-" + std::to_string(getpid());
+    {
+        onyx::FileSessionStorage file(path, 1 << 16, std::chrono::seconds(3600));
+        measureStorage("FileSessionStorage", file, operations / 4);
+    }
+    unlink(path.c_str());
+    return 0;
+}
@@ -3,19 +3,58 @@
 #include "Application.h"
 #include "request/Request.h"
 #include "response/JsonResponse.h"
+#include "response/PlainTextResponse.h"
 #include "dispatcher/Dispatcher.h"
+#include "response/ResponseWriter.h"
+
+namespace {
+
+    class FcgiResponseWriter : public onyx::ResponseWriter {
+    private:
+        FCGX_Stream * m_out;
+
+    protected:
+
+        virtual void writeBlock(const char * data, size_t size) override {
+            FCGX_PutStr(data, size, m_out);
+        }
+
+    public:
+
+        explicit FcgiResponseWriter(FCGX_Stream * out) : m_out(out) {
+        }
+    };
+
+    const char * reasonPhrase(int code) {
+        switch (code) {
+            case 400: return "Bad Request";
+            case 401: return "Unauthorized";
+            case 403: return "Forbidden";
+            case 404: return "Not Found";
+            case 405: return "Method Not Allowed";
+            case 413: return "Payload Too Large";
+            case 415: return "Unsupported Media Type";
+            case 422: return "Unprocessable Entity";
+            case 500: return "Internal Server Error";
+            case 501: return "Not Implemented";
+            case 503: return "Service Unavailable";
+            default: return code < 500 ? "Client Error" : "Server Error";
+        }
+    }
+}
 
 onyx::Application::Application() {
     m_file_log_appender = nullptr;
     m_console_log_appender = new plog::ColorConsoleAppender<plog::TxtFormatter>;
     m_dispatcher = onyx::Dispatcher::getInstance();
+    m_metrics = onyx::Metrics::getInstance();
     init();
 }
 
 void onyx::Application::run() {
     onyx::Security * security = m_dispatcher->getSecurity();
 
-    if (security->getCallbackUser() == nullptr || security->getSessionStorage() == nullptr) {
+    if (security->getCallbackUser() == nullptr || (security->getSessionStorage() == nullptr && !security->isSignedSessions())) {
         std::cerr << "CallbackRole function or session storage are undefined. Application stoped" << std::endl;
         exit(EXIT_FAILURE);
     }
@@ -43,23 +82,40 @@ void onyx::Application::handler() {
         if (rc < 0)
             continue;
 
+        if (m_metrics->isEnabled()) {
+            const char * request_start = FCGX_GetParam("REQUEST_START", request.envp);
+            m_metrics->recordQueueTime(request_start ? request_start : FCGX_GetParam("HTTP_X_REQUEST_START", request.envp));
+        }
+
         const char * server_name = FCGX_GetParam("SERVER_NAME", request.envp);
         const char * request_ip_address = FCGX_GetParam("REMOTE_ADDR", request.envp);
         const char * request_url = FCGX_GetParam("REQUEST_URI", request.envp);
         const char * request_method = FCGX_GetParam("REQUEST_METHOD", request.envp);
         const char * request_content_type = FCGX_GetParam("CONTENT_TYPE", request.envp);
         const char * request_cookie = FCGX_GetParam("HTTP_COOKIE", request.envp);
+        const char * request_accept = FCGX_GetParam("HTTP_ACCEPT", request.envp);
+        const char * request_csrf_token = FCGX_GetParam("HTTP_X_CSRF_TOKEN", request.envp);
         const char * request_params = FCGX_GetParam("QUERY_STRING", request.envp);
         char * content_length_str = FCGX_GetParam("CONTENT_LENGTH", request.envp);
-        size_t content_length = strtol(content_length_str, &content_length_str, 10);
+        size_t content_length = content_length_str ? strtol(content_length_str, &content_length_str, 10) : 0;
 
         onyx::Request onyx_request;
 
-        if (content_length > 0) {
-            std::unique_ptr<char[] > buffer(new char[content_length + 1]);
-            memset(buffer.get(), '\0', content_length + 1);
-            FCGX_GetStr(buffer.get(), content_length, request.in);
-            onyx_request.setBody(buffer.get());
+        if (content_length > 0 && request_content_type && strncasecmp(request_content_type, "multipart/", 10) == 0) {
+            // multipart bodies are streamed to the handler, see onyx::ONObject::getMultipart
+            FCGX_Stream * in = request.in;
+            size_t remaining = content_length;
+            onyx_request.setBodyReader([in, remaining](char * buffer, size_t size) mutable -> size_t {
+                int read = FCGX_GetStr(buffer, std::min(size, remaining), in);
+                if (read <= 0)
+                    return 0;
+                remaining -= read;
+                return read;
+            });
+        } else if (content_length > 0) {
+            std::unique_ptr<char[] > buffer(new char[content_length]);
+            int read = FCGX_GetStr(buffer.get(), content_length, request.in);
+            onyx_request.setBody(buffer.get(), read > 0 ? read : 0);
         }
         if (request_cookie)
             onyx_request.setCookies(request_cookie);
@@ -69,19 +125,58 @@ void onyx::Application::handler() {
         onyx_request.setMethod(request_method);
         onyx_request.setParams(request_params);
         onyx_request.setContentType(request_content_type);
-        std::string response_str = m_dispatcher->getResponseStr(onyx_request);
-        FCGX_PutStr(response_str.c_str(), response_str.size(), request.out);
+        if (request_accept)
+            onyx_request.setAccept(request_accept);
+        if (request_csrf_token)
+            onyx_request.setCSRFToken(request_csrf_token);
+        FcgiResponseWriter writer(request.out);
+        onyx_request.setResponseWriter(&writer);
+        std::string response_str;
+        try {
+            response_str = m_dispatcher->getResponseStr(onyx_request);
+        } catch (const onyx::Exception & ex) {
+            // client errors (malformed body, multipart, ...) keep their status, the others are 500
+            int code = ex.code() >= 400 && ex.code() < 600 ? ex.code() : 500;
+            bool replaced = writer.discard();
+            if (replaced) {
+                onyx::PlainTextResponse error(reasonPhrase(code));
+                error.addHeader("Status: " + std::to_string(code) + " " + reasonPhrase(code));
+                response_str = error;
+            }
+            if (code < 500)
+                LOGW << "Request url " << onyx_request.getUrl() << ". Method " << onyx_request.getMethod() << ". " << (replaced ? "" : "Response truncated: ") << code << " " << ex.what();
+            else
+                LOGE << "Request url " << onyx_request.getUrl() << ". Method " << onyx_request.getMethod() << ". " << (replaced ? "" : "Response truncated: ") << ex.what();
+        } catch (const std::exception & ex) {
+            // a response partly passed to the web server can only be cut short
+            if (writer.discard()) {
+                onyx::PlainTextResponse error("Internal Server Error");
+                error.addHeader("Status: 500 Internal Server Error");
+                response_str = error;
+                LOGE << "Request url " << onyx_request.getUrl() << ". Method " << onyx_request.getMethod() << ". " << ex.what();
+            } else
+                LOGE << "Request url " << onyx_request.getUrl() << ". Method " << onyx_request.getMethod() << ". Response truncated: " << ex.what();
+        }
+        writer.write(response_str);
+        writer.flush();
         FCGX_Finish_r(&request);
     }
     return;
 }
 
-void onyx::Application::addRoute(const std::string& method, const std::string& regex, std::function<std::string(onyx::ONObject & object) > function, std::vector<std::string> roles) noexcept {
+void onyx::Application::addRoute(const std::string& method, const std::string& regex, std::function<std::string(onyx::ONObject & object) > function, std::vector<std::string> roles, bool json_fast_path) noexcept {
     onyx::Dispatcher::Route route;
     route.m_method = method;
     route.m_regex = regex;
     route.m_function = function;
     route.m_roles = roles;
+    route.m_json_fast_path = json_fast_path;
+    try {
+        route.m_role_mask = onyx::RoleRegistry::getInstance()->getMask(roles);
+    } catch (const onyx::Exception & ex) {
+        LOGE << ex.what();
+        return;
+    }
 
     int err;
     err = regcomp(&route.m_preg, route.m_regex.c_str(), REG_EXTENDED);
@@ -119,9 +214,99 @@ void onyx::Application::setAppSettings(const std::string & path_config_file) {
             m_log_file_path = settings["log"].get<std::string>();
         if (settings.find("threads") != settings.end())
             m_thread_count = settings["threads"].get<int>();
+        onyx::multipart::Settings multipart_settings;
+        if (settings.find("multipart_memory_limit") != settings.end())
+            multipart_settings.memory_limit = settings["multipart_memory_limit"].get<size_t>();
+        if (settings.find("multipart_tmp_dir") != settings.end())
+            multipart_settings.tmp_dir = settings["multipart_tmp_dir"].get<std::string>();
+        m_dispatcher->setMultipartSettings(multipart_settings);
+        if (settings.find("session_cache_capacity") != settings.end()) {
+            size_t ttl = 60;
+            if (settings.find("session_cache_ttl") != settings.end())
+                ttl = settings["session_cache_ttl"].get<size_t>();
+            size_t shards = 16;
+            if (settings.find("session_cache_shards") != settings.end())
+                shards = settings["session_cache_shards"].get<size_t>();
+            onyx::Security::getInstance()->setSessionCache(settings["session_cache_capacity"].get<size_t>(), std::chrono::seconds(ttl), shards);
+        }
+        if (settings.find("session_storage") != settings.end()) {
+            std::chrono::seconds ttl(60 * 60 * 24 * 30);
+            if (settings.find("session_ttl") != settings.end())
+                ttl = std::chrono::seconds(settings["session_ttl"].get<size_t>());
+            std::string storage = settings["session_storage"].get<std::string>();
+            if (storage == "memory") {
+                size_t shards = 16;
+                if (settings.find("session_storage_shards") != settings.end())
+                    shards = settings["session_storage_shards"].get<size_t>();
+                onyx::Security::getInstance()->setSessionStorage(new onyx::MemorySessionStorage(ttl, shards));
+            }
+            else if (storage == "file") {
+                size_t capacity = 1 << 20;
+                if (settings.find("session_storage_capacity") != settings.end())
+                    capacity = settings["session_storage_capacity"].get<size_t>();
+                onyx::Security::getInstance()->setSessionStorage(new onyx::FileSessionStorage(settings["session_storage_file"].get<std::string>(), capacity, ttl));
+            }
+        }
+        if (settings.find("session_write_behind") != settings.end() && settings["session_write_behind"].get<bool>()) {
+            onyx::WriteBehindStorage::Settings write_behind;
+            if (settings.find("session_write_behind_batch") != settings.end())
+                write_behind.batch_size = settings["session_write_behind_batch"].get<size_t>();
+            if (settings.find("session_write_behind_interval") != settings.end())
+                write_behind.flush_interval = std::chrono::milliseconds(settings["session_write_behind_interval"].get<size_t>());
+            if (settings.find("session_write_behind_durability") != settings.end()) {
+                std::string durability = settings["session_write_behind_durability"].get<std::string>();
+                if (durability == "async")
+                    write_behind.durability = onyx::WriteBehindStorage::Durability::ASYNC;
+                else if (durability == "sync")
+                    write_behind.durability = onyx::WriteBehindStorage::Durability::SYNC;
+                else
+                    write_behind.durability = onyx::WriteBehindStorage::Durability::SYNC_REMOVE;
+            }
+            onyx::Security::getInstance()->setSessionWriteBehind(true, write_behind);
+        }
+        if (settings.find("session_batch_window") != settings.end()) {
+            size_t batch_size = 64;
+            if (settings.find("session_batch_size") != settings.end())
+                batch_size = settings["session_batch_size"].get<size_t>();
+            onyx::Security::getInstance()->setSessionBatching(std::chrono::microseconds(settings["session_batch_window"].get<size_t>()), batch_size);
+        }
+        if (settings.find("session_filter_capacity") != settings.end()) {
+            double rate = 0.01;
+            if (settings.find("session_filter_rate") != settings.end())
+                rate = settings["session_filter_rate"].get<double>();
+            std::chrono::seconds rebuild_interval(300);
+            if (settings.find("session_filter_rebuild_interval") != settings.end())
+                rebuild_interval = std::chrono::seconds(settings["session_filter_rebuild_interval"].get<size_t>());
+            onyx::Security::getInstance()->setSessionFilter(settings["session_filter_capacity"].get<size_t>(), rate, rebuild_interval);
+        }
+        if (settings.find("metrics_route") != settings.end()) {
+            // internal route for Prometheus, the web server should keep it from the outside
+            std::string metrics_route = settings["metrics_route"].get<std::string>();
+            m_metrics->setEnabled(true);
+            onyx::Metrics * metrics = m_metrics;
+            addRoute("GET", "^" + metrics_route + "$", [metrics](onyx::ONObject &) -> std::string {
+                return onyx::PlainTextResponse(metrics->render());
+            });
+        }
+        if (settings.find("role_hierarchy") != settings.end()) {
+            // {"admin": ["editor"]}: an admin also has the editor role
+            for (auto it = settings["role_hierarchy"].begin(); it != settings["role_hierarchy"].end(); ++it)
+                onyx::RoleRegistry::getInstance()->addInclusion(it.key(), it.value().get<std::vector<std::string>>());
+        }
+        if (settings.find("session_signing_key") != settings.end()) {
+            std::chrono::seconds ttl(60 * 60 * 24 * 30);
+            if (settings.find("session_ttl") != settings.end())
+                ttl = std::chrono::seconds(settings["session_ttl"].get<size_t>());
+            onyx::Security::getInstance()->setSessionSigningKey(settings["session_signing_key"].get<std::string>(), ttl);
+        }
+        if (settings.find("templates") != settings.end())
+            onyx::TemplateRegistry::getInstance()->setDirectory(settings["templates"].get<std::string>());
         m_mode_debug = false;
         if (settings.find("debug") != settings.end())
             m_mode_debug = settings["debug"].get<bool>();
+    } catch (const onyx::Exception & ex) {
+        std::cerr << ex.what() << ". Application stopped" << std::endl;
+        exit(EXIT_FAILURE);
     } catch (...) {
         std::cerr << "Invalid format of configuration file. Application stopped" << std::endl;
         exit(EXIT_FAILURE);
@@ -5,6 +5,7 @@
 #include <fcgiapp.h>
 #include <string>
 #include <string.h>
+#include <strings.h>
 #include <thread>
 #include <vector>
 #include <iostream>
@@ -27,6 +28,11 @@
 #include "dispatcher/Dispatcher.h"
 
 #include "security/Security.h"
+#include "security/RoleRegistry.h"
+#include "metrics/Metrics.h"
+#include "session/MemorySessionStorage.h"
+#include "session/FileSessionStorage.h"
+#include "template/TemplateRegistry.h"
 
 #include "handlers/404.h"
 
@@ -46,6 +52,7 @@ namespace onyx {
         int m_socket_id; 
         
         Dispatcher * m_dispatcher;
+        Metrics * m_metrics;
         std::vector<std::thread> m_threads;
         std::mutex m_mutex_instance; 
         plog::RollingFileAppender<plog::TxtFormatter> * m_file_log_appender; 
@@ -70,11 +77,25 @@ namespace onyx {
         
         /**
             add route
+            json_fast_path - ONObject::getJson parses the body with the vectorized parser (onyx::fastjson),
+            for routes receiving large JSON documents
         */
-        void addRoute(const std::string & method, const std::string & regex, std::function<std::string(onyx::ONObject &)> function, std::vector<std::string> roles = {}) noexcept;
+        void addRoute(const std::string & method, const std::string & regex, std::function<std::string(onyx::ONObject &)> function, std::vector<std::string> roles = {}, bool json_fast_path = false) noexcept;
+
+        /*
+            add a stage to the request pipeline (auth, compression, caching...), see Dispatcher::Middleware.
+            Stages of the same Dispatcher::MiddlewareStage run in the order they were added: by default
+            after the role check, BEFORE_AUTHORIZATION for the ones that must see every request of a route
+            (rate limiting, CORS headers). Add them before run()
+        */
+        void addMiddleware(Dispatcher::Middleware middleware, Dispatcher::MiddlewareStage stage = Dispatcher::MiddlewareStage::AFTER_AUTHORIZATION) {
+            m_dispatcher->addMiddleware(middleware, stage);
+        }
         
         /*
-            activate check csrf token
+            activate check csrf token. Templates rendered with HtmlResponse(obj, ...) get the token
+            as {{csrf_token_value}}, %%csrf_token_value%% markers are replaced only in responses
+            of handlers calling ONObject::requestCSRFSubstitution()
         */
         void setCSRFTokenEnabled(bool csrf_token_enabled) {
             m_dispatcher->setCSRFTokenEnabled(csrf_token_enabled);
@@ -0,0 +1,51 @@
+#include "Arena.h"
+
+thread_local onyx::arena::Arena * onyx::arena::Arena::m_current = nullptr;
+const size_t onyx::arena::Arena::FIRST_BLOCK_SIZE;
+const size_t onyx::arena::Arena::MAX_BLOCK_SIZE;
+const size_t onyx::arena::Arena::HEADER_SIZE;
+
+onyx::arena::Arena::Region::~Region() {
+    for (auto & block : m_blocks)
+        ::operator delete(block.m_data);
+}
+
+onyx::arena::Arena::Arena() : m_region(new Region), m_ptr(nullptr), m_end(nullptr), m_allocated(0) {
+}
+
+onyx::arena::Arena::~Arena() {
+    unreference(m_region);
+}
+
+void onyx::arena::Arena::grow(size_t size) {
+    std::vector<Block> & blocks = m_region->m_blocks;
+    size_t block_size = blocks.empty() ? FIRST_BLOCK_SIZE : std::min(blocks.back().m_size * 2, MAX_BLOCK_SIZE);
+    if (block_size < size)
+        block_size = size;
+    Block block;
+    block.m_data = static_cast<char *> (::operator new(block_size));
+    block.m_size = block_size;
+    blocks.push_back(block);
+    m_ptr = block.m_data;
+    m_end = block.m_data + block_size;
+}
+
+void onyx::arena::Arena::release() {
+    m_allocated = 0;
+    if (m_region->m_references.load(std::memory_order_acquire) != 1) {
+        // tracked memory outlives the request, the region goes with the last of it
+        unreference(m_region);
+        m_region = new Region;
+        m_ptr = nullptr;
+        m_end = nullptr;
+        return;
+    }
+    std::vector<Block> & blocks = m_region->m_blocks;
+    if (blocks.empty())
+        return;
+    for (size_t i = 1; i < blocks.size(); i++)
+        ::operator delete(blocks[i].m_data);
+    blocks.resize(1);
+    m_ptr = blocks[0].m_data;
+    m_end = blocks[0].m_data + blocks[0].m_size;
+}
@@ -0,0 +1,215 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include <new>
+#include <map>
+#include <string>
+#include "../common/json/json.hpp"
+
+namespace onyx {
+
+    namespace arena {
+
+        /*
+         * Bump allocator released in bulk. The dispatcher binds one arena per worker thread to every request
+         * (see Arena::Scope), memory taken from it is valid until the request is finished
+         */
+        class Arena {
+        private:
+            struct Block {
+                char * m_data;
+                size_t m_size;
+            };
+
+            /*
+             * blocks handed out since the last release. Memory taken through allocateTracked holds
+             * a reference, so the region outlives the request while such memory is still in use
+             */
+            struct Region {
+                std::vector<Block> m_blocks;
+                /*
+                 * the arena and the tracked allocations
+                 */
+                std::atomic<size_t> m_references;
+
+                Region() : m_references(1) {
+                }
+
+                ~Region();
+            };
+
+            static const size_t FIRST_BLOCK_SIZE = 64 * 1024;
+            static const size_t MAX_BLOCK_SIZE = 1024 * 1024;
+
+            Region * m_region;
+            char * m_ptr;
+            char * m_end;
+            size_t m_allocated;
+
+            static thread_local Arena * m_current;
+
+            void grow(size_t size);
+
+            static void unreference(Region * region) {
+                if (region->m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete region;
+            }
+
+        public:
+
+            Arena();
+            ~Arena();
+
+            Arena(const Arena &) = delete;
+            Arena & operator=(const Arena &) = delete;
+
+            void * allocate(size_t size, size_t align = alignof(std::max_align_t)) {
+                uintptr_t aligned = (reinterpret_cast<uintptr_t> (m_ptr) + align - 1) & ~(uintptr_t) (align - 1);
+                if (m_ptr == nullptr || aligned + size > reinterpret_cast<uintptr_t> (m_end)) {
+                    grow(size + align);
+                    aligned = (reinterpret_cast<uintptr_t> (m_ptr) + align - 1) & ~(uintptr_t) (align - 1);
+                }
+                m_ptr = reinterpret_cast<char *> (aligned + size);
+                m_allocated += size;
+                return reinterpret_cast<void *> (aligned);
+            }
+
+            /*
+             * nothing is freed except the most recent allocation, which is handed out again
+             */
+            void deallocate(void * ptr, size_t size) {
+                if (static_cast<char *> (ptr) + size == m_ptr)
+                    m_ptr = static_cast<char *> (ptr);
+            }
+
+            /*
+             * free everything, the first block is kept for the next request. Blocks still holding
+             * tracked allocations are left to them and freed with the last one
+             */
+            void release();
+
+            /*
+             * size of the header in front of tracked allocations, which names their region
+             */
+            static const size_t HEADER_SIZE = alignof(std::max_align_t);
+
+            /*
+             * memory from the arena bound to the calling thread, from the heap without one. It stays
+             * valid until deallocateTracked, on any thread, even after the request is finished
+             */
+            static void * allocateTracked(size_t size) {
+                Arena * arena = m_current;
+                Region * region = nullptr;
+                char * data;
+                if (arena != nullptr) {
+                    data = static_cast<char *> (arena->allocate(size + HEADER_SIZE, HEADER_SIZE));
+                    region = arena->m_region;
+                    region->m_references.fetch_add(1, std::memory_order_relaxed);
+                } else
+                    data = static_cast<char *> (::operator new(size + HEADER_SIZE));
+                *reinterpret_cast<Region **> (data) = region;
+                return data + HEADER_SIZE;
+            }
+
+            static void deallocateTracked(void * ptr, size_t size) noexcept {
+                char * data = static_cast<char *> (ptr) - HEADER_SIZE;
+                Region * region = *reinterpret_cast<Region **> (data);
+                if (region == nullptr) {
+                    ::operator delete(data);
+                    return;
+                }
+                // the region of the calling thread's request may hand the memory out again
+                Arena * arena = m_current;
+                if (arena != nullptr && arena->m_region == region)
+                    arena->deallocate(data, size + HEADER_SIZE);
+                unreference(region);
+            }
+
+            /*
+             * bytes handed out since the last release
+             */
+            size_t allocated() const {
+                return m_allocated;
+            }
+
+            /*
+             * arena bound to the calling thread or nullptr
+             */
+            static Arena * current() {
+                return m_current;
+            }
+
+            /*
+             * binds an arena to the calling thread and releases it when leaving the scope
+             */
+            class Scope {
+            private:
+                Arena & m_arena;
+                Arena * m_previous;
+            public:
+
+                explicit Scope(Arena & arena) : m_arena(arena), m_previous(m_current) {
+                    m_current = &arena;
+                }
+
+                ~Scope() {
+                    m_current = m_previous;
+                    m_arena.release();
+                }
+
+                Scope(const Scope &) = delete;
+                Scope & operator=(const Scope &) = delete;
+            };
+        };
+
+        /*
+         * Standard allocator drawing from the arena of the current request,
+         * from the heap when no arena is bound to the thread. Every allocation records where it
+         * comes from (see Arena::allocateTracked), so it may be freed after the request or on another thread
+         */
+        template<typename T>
+        class Allocator {
+        public:
+            typedef T value_type;
+
+            Allocator() noexcept {
+            }
+
+            template<typename U>
+            Allocator(const Allocator<U> &) noexcept {
+            }
+
+            T * allocate(size_t n) {
+                static_assert(alignof(T) <= Arena::HEADER_SIZE, "over-aligned types aren't supported");
+                return static_cast<T *> (Arena::allocateTracked(n * sizeof (T)));
+            }
+
+            void deallocate(T * ptr, size_t n) noexcept {
+                Arena::deallocateTracked(ptr, n * sizeof (T));
+            }
+
+            template<typename U>
+            bool operator==(const Allocator<U> &) const noexcept {
+                return true;
+            }
+
+            template<typename U>
+            bool operator!=(const Allocator<U> &) const noexcept {
+                return false;
+            }
+        };
+
+        /*
+         * JSON document whose objects and arrays live in the arena of the current request.
+         * Meant to be built and dropped inside the handler; one kept longer stays valid but pins
+         * the blocks of its request until it is destroyed. Strings use the heap (short ones stay inline)
+         */
+        using json = nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t, double, Allocator>;
+    }
+}
+
+#endif
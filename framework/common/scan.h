@@ -0,0 +1,82 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace onyx {
+    namespace utils {
+
+        /*
+         * Call f(position) for every byte of [data, data + size) equal to one of a, b, c or d,
+         * in ascending order. Uses AVX2 or SSE2 when the compiler targets them, a scalar loop otherwise.
+         * f returns false to stop the scan early.
+         */
+        template<typename F>
+        static inline void scan_any_of(const char * data, size_t size, char a, char b, char c, char d, F && f) {
+            size_t i = 0;
+#if defined(__AVX2__)
+            const __m256i va = _mm256_set1_epi8(a);
+            const __m256i vb = _mm256_set1_epi8(b);
+            const __m256i vc = _mm256_set1_epi8(c);
+            const __m256i vd = _mm256_set1_epi8(d);
+            for (; i + 32 <= size; i += 32) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *> (data + i));
+                __m256i hit = _mm256_or_si256(
+                        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, va), _mm256_cmpeq_epi8(chunk, vb)),
+                        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, vc), _mm256_cmpeq_epi8(chunk, vd)));
+                uint32_t mask = static_cast<uint32_t> (_mm256_movemask_epi8(hit));
+                while (mask != 0) {
+                    if (!f(i + __builtin_ctz(mask)))
+                        return;
+                    mask &= mask - 1;
+                }
+            }
+#elif defined(__SSE2__)
+            const __m128i va = _mm_set1_epi8(a);
+            const __m128i vb = _mm_set1_epi8(b);
+            const __m128i vc = _mm_set1_epi8(c);
+            const __m128i vd = _mm_set1_epi8(d);
+            for (; i + 16 <= size; i += 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *> (data + i));
+                __m128i hit = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)),
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, vc), _mm_cmpeq_epi8(chunk, vd)));
+                uint32_t mask = static_cast<uint32_t> (_mm_movemask_epi8(hit));
+                while (mask != 0) {
+                    if (!f(i + __builtin_ctz(mask)))
+                        return;
+                    mask &= mask - 1;
+                }
+            }
+#endif
+            for (; i < size; i++) {
+                char ch = data[i];
+                if (ch == a || ch == b || ch == c || ch == d) {
+                    if (!f(i))
+                        return;
+                }
+            }
+        }
+
+        /*
+         * Position of the first byte equal to one of a, b, c or d, or size when there is none
+         */
+        static inline size_t find_any_of(const char * data, size_t size, char a, char b, char c, char d) {
+            size_t found = size;
+            scan_any_of(data, size, a, b, c, d, [&found](size_t pos) {
+                found = pos;
+                return false;
+            });
+            return found;
+        }
+    }
+}
+
+#endif
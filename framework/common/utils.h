@@ -3,6 +3,11 @@
 
 #include <functional>
 #include <algorithm>
+#include <string>
+#include <string.h>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include "scan.h"
 
 namespace onyx {
     namespace utils {
@@ -34,24 +39,147 @@ namespace onyx {
         }
         
         /*
-         * Decode url string
+         * Value of a hex digit or -1
          */
+        static inline int hex_value(unsigned char ch) {
+            static const signed char table[256] = {
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+                -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+            };
+            return table[ch];
+        }
+
+        /*
+         * Decode url string of the given size in place and return the decoded size.
+         * Runs without '%' (and '+' when plus_as_space) are skipped with a vectorized scan.
+         * A malformed or truncated escape is kept as is
+         */
+        static inline size_t urldecode(char * data, size_t size, bool plus_as_space = true) {
+            const char plus = plus_as_space ? '+' : '%';
+            size_t read = onyx::utils::find_any_of(data, size, '%', plus, '%', '%');
+            size_t write = read;
+            while (read < size) {
+                char ch = data[read];
+                if (ch == '%') {
+                    int hi = read + 2 < size ? hex_value(data[read + 1]) : -1;
+                    int lo = hi >= 0 ? hex_value(data[read + 2]) : -1;
+                    if (lo >= 0) {
+                        data[write++] = static_cast<char> ((hi << 4) | lo);
+                        read += 3;
+                    } else
+                        data[write++] = data[read++];
+                } else {
+                    data[write++] = ' ';
+                    read++;
+                }
+                size_t run = onyx::utils::find_any_of(data + read, size - read, '%', plus, '%', '%');
+                if (write != read)
+                    memmove(data + write, data + read, run);
+                write += run;
+                read += run;
+            }
+            return write;
+        }
+
+        /*
+         * Decode url string into a new string
+         */
+        static inline std::string urldecode(boost::string_view source, bool plus_as_space = true) {
+            std::string decoded(source.data(), source.size());
+            decoded.resize(urldecode(&decoded[0], decoded.size(), plus_as_space));
+            return decoded;
+        }
+
+        /*
+         * Decode null-terminated url string in place
+         */
+        static inline void urldecode(char *st) {
+            size_t size = urldecode(st, strlen(st));
+            st[size] = '\0';
+        }
 
-        static void urldecode(char *st) {
-            char *p = st;
-            char hex[3];
-            int code;
-            do {
-                if (*st == '%') {
-                    hex[0] = *(++st);
-                    hex[1] = *(++st);
-                    hex[2] = 0;
-                    sscanf(hex, "%X", &code);
-                    *p++ = (char) code;
+        /*
+         * Size of size bytes encoded as base64url without padding
+         */
+        static inline size_t base64url_size(size_t size) {
+            return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+        }
+
+        /*
+         * Encode size bytes as base64url without padding into output of base64url_size(size) characters
+         */
+        static inline void base64url_encode(const unsigned char * data, size_t size, char * output) {
+            static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+            size_t i = 0;
+            for (; i + 3 <= size; i += 3) {
+                uint32_t triple = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+                *output++ = alphabet[triple >> 18];
+                *output++ = alphabet[(triple >> 12) & 0x3f];
+                *output++ = alphabet[(triple >> 6) & 0x3f];
+                *output++ = alphabet[triple & 0x3f];
+            }
+            if (size - i == 1) {
+                *output++ = alphabet[data[i] >> 2];
+                *output++ = alphabet[(data[i] & 0x03) << 4];
+            } else if (size - i == 2) {
+                *output++ = alphabet[data[i] >> 2];
+                *output++ = alphabet[((data[i] & 0x03) << 4) | (data[i + 1] >> 4)];
+                *output++ = alphabet[(data[i + 1] & 0x0f) << 2];
+            }
+        }
+
+        static inline std::string base64url_encode(boost::string_view data) {
+            std::string encoded(base64url_size(data.size()), '\0');
+            base64url_encode(reinterpret_cast<const unsigned char *> (data.data()), data.size(), &encoded[0]);
+            return encoded;
+        }
+
+        /*
+         * Decode base64url without padding, false for any other character or an impossible length
+         */
+        static inline bool base64url_decode(boost::string_view source, std::string & decoded) {
+            if (source.size() % 4 == 1)
+                return false;
+            decoded.clear();
+            decoded.reserve(source.size() / 4 * 3 + 2);
+            uint32_t bits = 0;
+            int count = 0;
+            for (char ch : source) {
+                int value;
+                if (ch >= 'A' && ch <= 'Z')
+                    value = ch - 'A';
+                else if (ch >= 'a' && ch <= 'z')
+                    value = ch - 'a' + 26;
+                else if (ch >= '0' && ch <= '9')
+                    value = ch - '0' + 52;
+                else if (ch == '-')
+                    value = 62;
+                else if (ch == '_')
+                    value = 63;
+                else
+                    return false;
+                bits = (bits << 6) | value;
+                count += 6;
+                if (count >= 8) {
+                    count -= 8;
+                    decoded.push_back(static_cast<char> ((bits >> count) & 0xff));
                 }
-                else if (*st == '+') *p++ = ' ';
-                else *p++ = *st;
-            } while (*st++ != 0);
+            }
+            return true;
         }
     }
 
@@ -6,48 +6,89 @@
 #include "../response/RedirectResponse.h"
 #include "../Application.h"
 #include "FiltersChain/FilterChainCheckRole.h"
-#include "FiltersChain/FilterChainPost.h"
-#include "FiltersChain/FilterChainGet.h"
+#include "FiltersChain/FilterChainCSRF.h"
+#include "FiltersChain/FilterChainHandler.h"
+#include "../arena/Arena.h"
+#include "../metrics/Metrics.h"
 
 onyx::Dispatcher * onyx::Dispatcher::m_instance = nullptr;
 
 void onyx::Dispatcher::addRoute(Route route) {
     m_routes.push_back(route);
+    onyx::Metrics::getInstance()->addRoute(route.m_method, route.m_regex);
+}
+
+void onyx::Dispatcher::addMiddleware(Middleware middleware, MiddlewareStage stage) {
+    if (stage == MiddlewareStage::BEFORE_AUTHORIZATION)
+        m_middleware.insert(m_middleware.begin() + m_authorization++, middleware);
+    else
+        m_middleware.push_back(middleware);
 }
 
 onyx::Dispatcher::Dispatcher() {
     m_security = onyx::Security::getInstance();
+    m_authorization = 0;
+}
+
+std::string onyx::Dispatcher::Next::operator()(const onyx::Request & request, onyx::ONObject & obj, const Route & route) const {
+    // stages: m_middleware[0, m_authorization), role check, m_middleware[m_authorization, size), CSRF check, handler
+    Next next(m_middleware, m_authorization, m_index + 1);
+    if (m_index < m_authorization)
+        return (*m_middleware)[m_index](request, obj, route, next);
+    if (m_index == m_authorization)
+        return FilterChainCheckRole::handler(request, obj, route, next);
+    if (m_index <= m_middleware->size())
+        return (*m_middleware)[m_index - 1](request, obj, route, next);
+    if (m_index == m_middleware->size() + 1)
+        return FilterChainCSRF::handler(request, obj, route, next);
+    return FilterChainHandler::handler(request, obj, route);
 }
 
 std::string onyx::Dispatcher::getResponseStr(const onyx::Request & request) const {
+    onyx::Metrics * metrics = onyx::Metrics::getInstance();
+    uint64_t start = metrics->isEnabled() ? onyx::Metrics::now() : 0;
+
+    // request-scoped allocations (onyx::arena::json) are released in bulk when the request is done
+    static thread_local onyx::arena::Arena arena;
+    onyx::arena::Arena::Scope arena_scope(arena);
+
     onyx::TokenCollection token(request.getUrl());
     onyx::ParamCollection params(request.getParams());
     onyx::CookieCollection cookies(request.getCookies());
-    onyx::ONObject obj(token, params, cookies, request.getBody());
-
-    // Получаем сессию
-    std::string sessionid;
-    if (cookies.has("sessionid"))
-        sessionid = cookies["sessionid"];
-    onyx::Security * security = onyx::Security::getInstance();
-    std::shared_ptr<onyx::Session> session(security->getSessionStorage()->fetchSession(sessionid));
-
-    // Инициализируем цепочку обработчиков запроса
-    FilterChainCheckRole filterChainCheckRole;
-    FilterChainPost * filterChainPost = new FilterChainPost();
-    FilterChainGet * filterChainGet = new FilterChainGet();
-    
-    filterChainCheckRole.setNextHandler(filterChainPost);
-    filterChainPost->setNextHandler(filterChainGet);
-
-    for (auto & route : m_routes) {
+    onyx::ONObject obj(token, params, cookies, request.getBody(), request.getContentType());
+    obj.setAccept(request.getAccept());
+    obj.setBodyReader(request.getBodyReader(), m_multipart_settings);
+    obj.setResponseWriter(request.getResponseWriter());
+
+    // Сессия загружается лениво: при проверке роли, CSRF токена или по запросу обработчика (ONObject::getSession)
+    if (cookies.has("sessionid")) {
+        // the cookie outlives obj, two pointers fit in std::function without an allocation
+        const std::string * sessionid = &cookies["sessionid"];
+        onyx::Security * security = onyx::Security::getInstance();
+        obj.setSessionLoader([security, sessionid]() {
+            return security->fetchSession(*sessionid);
+        });
+    }
+    obj.setCSRFEnabled(m_csrf_token_enabled);
+
+    for (size_t i = 0; i < m_routes.size(); i++) {
+        const Route & route = m_routes[i];
         regmatch_t pm;
         if (request.getMethod() == route.m_method) {
             if (regexec(&route.m_preg, request.getUrl().c_str(), 0, &pm, 0) == 0) {
-                return filterChainCheckRole.handler(request, obj, route, session, sessionid);
+                obj.setJsonFastPath(route.m_json_fast_path);
+                Next pipeline(&m_middleware, m_authorization, 0);
+                if (!metrics->isEnabled())
+                    return pipeline(request, obj, route);
+                onyx::Metrics::Scope scope(metrics, i, start);
+                std::string response = pipeline(request, obj, route);
+                scope.setResponse(response, request.getResponseWriter());
+                return response;
             }
         }
     }
+    if (metrics->isEnabled())
+        metrics->recordUnmatched();
     LOGE << "Request url " << request.getUrl() << ". Method " << request.getMethod() << ". Can't proccess";
     return onyx::handler::_404();
 }
\ No newline at end of file
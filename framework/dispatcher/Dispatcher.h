@@ -4,6 +4,7 @@
 #include <regex.h>
 #include <functional>
 #include <string>
+#include <vector>
 #include "../request/Request.h"
 #include "../common/plog/Log.h"
 #include "../response/BaseResponse.h"
@@ -34,6 +35,50 @@ namespace onyx {
             regex_t m_preg;
             std::function<std::string(onyx::ONObject &) > m_function;
             std::vector<std::string> m_roles;
+            /*
+             * onyx::RoleRegistry bits of m_roles, 0 when the route is open to everyone
+             */
+            uint64_t m_role_mask = 0;
+            bool m_json_fast_path = false;
+        };
+
+        class Next;
+
+        /*
+         * stage of the request pipeline: returns next(request, obj, route) to pass the request on
+         * or a response of its own, e.g. a cached one
+         */
+        typedef std::function<std::string(const onyx::Request &, onyx::ONObject &, const Route &, const Next &)> Middleware;
+
+        /*
+         * where added middleware runs: before the role check (rate limiting, CORS headers, ...)
+         * or after it, when the user of a restricted route is known to be allowed
+         */
+        enum class MiddlewareStage {
+            BEFORE_AUTHORIZATION,
+            AFTER_AUTHORIZATION
+        };
+
+        /*
+         * the stages after the current one: the middleware added BEFORE_AUTHORIZATION, the role check,
+         * the middleware added AFTER_AUTHORIZATION, the CSRF check, then the function of the route.
+         * The built-in stages are called directly, only the added middleware goes through std::function
+         */
+        class Next {
+        private:
+            const std::vector<Middleware> * m_middleware;
+            /*
+             * index of the role check, the middleware before it runs first
+             */
+            size_t m_authorization;
+            size_t m_index;
+
+        public:
+
+            Next(const std::vector<Middleware> * middleware, size_t authorization, size_t index) : m_middleware(middleware), m_authorization(authorization), m_index(index) {
+            }
+
+            std::string operator()(const onyx::Request & request, onyx::ONObject & obj, const Route & route) const;
         };
 
         static Dispatcher * getInstance() noexcept {
@@ -45,6 +90,13 @@ namespace onyx {
         std::string getResponseStr(const onyx::Request & request) const;
         
         void addRoute(Route route);
+
+        /*
+         * appended to the middleware of its stage, both run ahead of the CSRF check. Requests matching
+         * no route get a 404 without reaching any middleware.
+         * The middleware isn't synchronized, it must be added before the application runs
+         */
+        void addMiddleware(Middleware middleware, MiddlewareStage stage = MiddlewareStage::AFTER_AUTHORIZATION);
         
         onyx::Security* getSecurity() const {
             return m_security;
@@ -66,12 +118,26 @@ namespace onyx {
             m_csrf_token_enabled = csrf_token_enabled;
         }
 
+        const onyx::multipart::Settings & getMultipartSettings() const {
+            return m_multipart_settings;
+        }
+
+        void setMultipartSettings(const onyx::multipart::Settings & multipart_settings) {
+            m_multipart_settings = multipart_settings;
+        }
+
     private:
         
         bool m_csrf_token_enabled;
         std::string m_csrf_token_secret;
+        onyx::multipart::Settings m_multipart_settings;
 
         std::vector<Route> m_routes;
+        /*
+         * stages added before the role check, then the ones between the role check and the CSRF check
+         */
+        std::vector<Middleware> m_middleware;
+        size_t m_authorization;
 
         static Dispatcher * m_instance;
         onyx::Security * m_security;
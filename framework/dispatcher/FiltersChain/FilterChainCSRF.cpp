@@ -0,0 +1,20 @@
+#include "FilterChainCSRF.h"
+
+std::string FilterChainCSRF::handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, const onyx::Dispatcher::Next & next) {
+    if (request.getMethod() == "POST" && onyx::Dispatcher::getInstance()->isCSRFTokenEnabled()) {
+        std::shared_ptr<const onyx::Session> session = obj.getSession();
+        if (session) {
+            // the X-CSRF-Token header, else the csrf_token field of an urlencoded or multipart form
+            std::string csrf_token = request.getCSRFToken();
+            if (csrf_token.empty() && !obj.getFormField("csrf_token", csrf_token)){
+                LOGD << "Request url " << request.getUrl() << ". Method " << request.getMethod() << ". Processed forbidden";
+                return onyx::handler::_403();
+            }
+            if (csrf_token != session->getToken()){
+                LOGD << "Request url " << request.getUrl() << ". Method " << request.getMethod() << ". Processed forbidden";
+                return onyx::handler::_403();
+            }
+        }
+    }
+    return next(request, obj, route);
+}
@@ -0,0 +1,18 @@
+#ifndef FILTERCHAINCSRF_H
+#define FILTERCHAINCSRF_H
+
+#include "../Dispatcher.h"
+#include "../../request/Request.h"
+#include <string>
+#include "../../handlers/403.h"
+
+/*
+ * POST requests of a session must carry its CSRF token when the protection is on, in the X-CSRF-Token
+ * header or the csrf_token field of the form (before the file uploads of a multipart form)
+ */
+class FilterChainCSRF {
+public:
+    static std::string handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, const onyx::Dispatcher::Next & next);
+};
+
+#endif
@@ -1,17 +1,16 @@
 #include "FilterChainCheckRole.h"
 
-std::string FilterChainCheckRole::handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, std::shared_ptr<onyx::Session> session,const std::string & sessionid) {
-    onyx::Security * security = onyx::Security::getInstance();
-    onyx::session::User user;
-    if (session)
-        user = session->getUser();
-    // Если есть ограничение по роли, но нет sessionid в куках или сессия отсутствует (не выполнен вход) редирект на login страницу
-    if (!route.m_roles.empty() && (sessionid == "" || !session))
-        return onyx::RedirectResponse("Login", security->getLoginURL());
-    // Если есть ограничение по роли и роль пользователя не подходит для данного route, то редирект 403
-    if (!route.m_roles.empty() && std::find(route.m_roles.begin(), route.m_roles.end(), user.getRole()) == route.m_roles.end()) {
-        return onyx::handler::_403();
+std::string FilterChainCheckRole::handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, const onyx::Dispatcher::Next & next) {
+    // Сессия загружается из хранилища только для маршрутов с ограничением по роли
+    if (route.m_role_mask != 0) {
+        onyx::Security * security = onyx::Security::getInstance();
+        std::shared_ptr<const onyx::Session> session = obj.getSession();
+        // Если есть ограничение по роли, но нет sessionid в куках или сессия отсутствует (не выполнен вход) редирект на login страницу
+        if (!session)
+            return onyx::RedirectResponse("Login", security->getLoginURL());
+        // Если есть ограничение по роли и роль пользователя не подходит для данного route, то редирект 403
+        if ((session->getRoleMask() & route.m_role_mask) == 0)
+            return onyx::handler::_403();
     }
-    if(m_nextFilterChain != nullptr)
-        return m_nextFilterChain->handler(request, obj, route, session, sessionid);
-}
\ No newline at end of file
+    return next(request, obj, route);
+}
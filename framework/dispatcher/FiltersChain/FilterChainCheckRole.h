@@ -1,12 +1,14 @@
 #ifndef FILTERCHAINAUTH_H
 #define FILTERCHAINAUTH_H
 
-#include "IBaseFilterChains.h"
+#include "../Dispatcher.h"
+#include "../../request/Request.h"
+#include <string>
+#include "../../handlers/403.h"
 
-class FilterChainCheckRole : public IBaseFilterChainAuth {
+class FilterChainCheckRole {
 public:
-    virtual std::string handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, std::shared_ptr<onyx::Session> session, const std::string & sessionid) override;
+    static std::string handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route, const onyx::Dispatcher::Next & next);
 };
 
 #endif
-
@@ -0,0 +1,12 @@
+#include "FilterChainHandler.h"
+
+std::string FilterChainHandler::handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route) {
+    std::string response = route.m_function(obj);
+    if (obj.isCSRFSubstitutionRequested()) {
+        std::string csrf_token = obj.getCSRFToken();
+        if (!csrf_token.empty())
+            boost::replace_all(response, "%%csrf_token_value%%", csrf_token);
+    }
+    LOGD << "Request url " << request.getUrl() << ". Method " << request.getMethod() << ". Processed success";
+    return response;
+}
@@ -0,0 +1,16 @@
+#ifndef FILTERCHAINHANDLER_H
+#define FILTERCHAINHANDLER_H
+
+#include "../Dispatcher.h"
+#include "../../request/Request.h"
+#include <string>
+
+/*
+ * end of the pipeline: runs the function of the route
+ */
+class FilterChainHandler {
+public:
+    static std::string handler(const onyx::Request & request, onyx::ONObject & obj, const onyx::Dispatcher::Route & route);
+};
+
+#endif
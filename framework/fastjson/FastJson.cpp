@@ -0,0 +1,713 @@
+#include "FastJson.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <locale.h>
+#include <limits>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ONYX_FASTJSON_X86
+#endif
+
+namespace {
+
+    /*
+     * bit i of each mask describes byte i of a 64-byte block
+     */
+    struct BlockMasks {
+        uint64_t quote;
+        uint64_t backslash;
+        uint64_t structural;
+        uint64_t whitespace;
+    };
+
+    typedef void (*ClassifyFunction)(const char * block, BlockMasks & masks);
+
+#ifdef ONYX_FASTJSON_X86
+
+    __attribute__((target("sse2")))
+    void classify_sse2(const char * block, BlockMasks & masks) {
+        masks.quote = masks.backslash = masks.structural = masks.whitespace = 0;
+        for (int i = 0; i < 4; i++) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *> (block + i * 16));
+            auto eq = [&chunk](char ch) {
+                return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(ch));
+            };
+            __m128i structural = _mm_or_si128(_mm_or_si128(_mm_or_si128(eq('{'), eq('}')), _mm_or_si128(eq('['), eq(']'))), _mm_or_si128(eq(':'), eq(',')));
+            __m128i whitespace = _mm_or_si128(_mm_or_si128(eq(' '), eq('\t')), _mm_or_si128(eq('\n'), eq('\r')));
+            int shift = i * 16;
+            masks.quote |= uint64_t(uint16_t(_mm_movemask_epi8(eq('"')))) << shift;
+            masks.backslash |= uint64_t(uint16_t(_mm_movemask_epi8(eq('\\')))) << shift;
+            masks.structural |= uint64_t(uint16_t(_mm_movemask_epi8(structural))) << shift;
+            masks.whitespace |= uint64_t(uint16_t(_mm_movemask_epi8(whitespace))) << shift;
+        }
+    }
+
+    __attribute__((target("avx2")))
+    void classify_avx2(const char * block, BlockMasks & masks) {
+        masks.quote = masks.backslash = masks.structural = masks.whitespace = 0;
+        for (int i = 0; i < 2; i++) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *> (block + i * 32));
+            auto eq = [&chunk](char ch) __attribute__((target("avx2"))) {
+                return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(ch));
+            };
+            __m256i structural = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(eq('{'), eq('}')), _mm256_or_si256(eq('['), eq(']'))), _mm256_or_si256(eq(':'), eq(',')));
+            __m256i whitespace = _mm256_or_si256(_mm256_or_si256(eq(' '), eq('\t')), _mm256_or_si256(eq('\n'), eq('\r')));
+            int shift = i * 32;
+            masks.quote |= uint64_t(uint32_t(_mm256_movemask_epi8(eq('"')))) << shift;
+            masks.backslash |= uint64_t(uint32_t(_mm256_movemask_epi8(eq('\\')))) << shift;
+            masks.structural |= uint64_t(uint32_t(_mm256_movemask_epi8(structural))) << shift;
+            masks.whitespace |= uint64_t(uint32_t(_mm256_movemask_epi8(whitespace))) << shift;
+        }
+    }
+
+    ClassifyFunction select_classify() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return classify_avx2;
+        return classify_sse2;
+    }
+#else
+
+    void classify_scalar(const char * block, BlockMasks & masks) {
+        masks.quote = masks.backslash = masks.structural = masks.whitespace = 0;
+        for (int i = 0; i < 64; i++) {
+            uint64_t bit = uint64_t(1) << i;
+            switch (block[i]) {
+                case '"':
+                    masks.quote |= bit;
+                    break;
+                case '\\':
+                    masks.backslash |= bit;
+                    break;
+                case '{': case '}': case '[': case ']': case ':': case ',':
+                    masks.structural |= bit;
+                    break;
+                case ' ': case '\t': case '\n': case '\r':
+                    masks.whitespace |= bit;
+                    break;
+            }
+        }
+    }
+
+    ClassifyFunction select_classify() {
+        return classify_scalar;
+    }
+#endif
+
+    const ClassifyFunction classify = select_classify();
+
+    /*
+     * bit i is the xor of bits 0..i: set from an opening quote up to (not including) the closing one
+     */
+    inline uint64_t prefix_xor(uint64_t bits) {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+    inline bool is_whitespace(char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+    }
+
+    inline bool is_digit(char ch) {
+        return ch >= '0' && ch <= '9';
+    }
+
+    bool is_number(boost::string_view token) {
+        size_t i = 0;
+        size_t size = token.size();
+        if (i < size && token[i] == '-')
+            i++;
+        if (i == size)
+            return false;
+        if (token[i] == '0')
+            i++;
+        else if (is_digit(token[i])) {
+            while (i < size && is_digit(token[i]))
+                i++;
+        } else
+            return false;
+        if (i < size && token[i] == '.') {
+            i++;
+            if (i == size || !is_digit(token[i]))
+                return false;
+            while (i < size && is_digit(token[i]))
+                i++;
+        }
+        if (i < size && (token[i] == 'e' || token[i] == 'E')) {
+            i++;
+            if (i < size && (token[i] == '+' || token[i] == '-'))
+                i++;
+            if (i == size || !is_digit(token[i]))
+                return false;
+            while (i < size && is_digit(token[i]))
+                i++;
+        }
+        return i == size;
+    }
+
+    void append_utf8(std::string & out, uint32_t code) {
+        if (code < 0x80)
+            out += static_cast<char> (code);
+        else if (code < 0x800) {
+            out += static_cast<char> (0xC0 | (code >> 6));
+            out += static_cast<char> (0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char> (0xE0 | (code >> 12));
+            out += static_cast<char> (0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char> (0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char> (0xF0 | (code >> 18));
+            out += static_cast<char> (0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char> (0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char> (0x80 | (code & 0x3F));
+        }
+    }
+
+    bool read_hex4(boost::string_view raw, size_t pos, uint32_t & code) {
+        if (pos + 4 > raw.size())
+            return false;
+        code = 0;
+        for (size_t i = pos; i < pos + 4; i++) {
+            char ch = raw[i];
+            code <<= 4;
+            if (is_digit(ch))
+                code |= ch - '0';
+            else if (ch >= 'a' && ch <= 'f')
+                code |= ch - 'a' + 10;
+            else if (ch >= 'A' && ch <= 'F')
+                code |= ch - 'A' + 10;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    /*
+     * nullptr when the content of a string is valid JSON, the error otherwise
+     */
+    const char * string_error(boost::string_view raw) {
+        for (size_t i = 0; i < raw.size(); i++) {
+            unsigned char ch = raw[i];
+            if (ch >= 0x20 && ch != '\\')
+                continue;
+            if (ch != '\\')
+                return "control character in string";
+            if (++i == raw.size())
+                return "invalid escape";
+            switch (raw[i]) {
+                case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                    break;
+                case 'u':
+                {
+                    uint32_t code;
+                    if (!read_hex4(raw, i + 1, code))
+                        return "invalid \\u escape";
+                    i += 4;
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        uint32_t low;
+                        if (i + 2 >= raw.size() || raw[i + 1] != '\\' || raw[i + 2] != 'u' || !read_hex4(raw, i + 3, low) || low < 0xDC00 || low > 0xDFFF)
+                            return "invalid surrogate pair";
+                        i += 6;
+                    } else if (code >= 0xDC00 && code <= 0xDFFF)
+                        return "invalid surrogate pair";
+                    break;
+                }
+                default:
+                    return "invalid escape";
+            }
+        }
+        return nullptr;
+    }
+
+    onyx::Exception invalid(const std::string & message) {
+        return onyx::Exception("Invalid JSON: " + message, 400);
+    }
+
+    /*
+     * a value of the document has another type, is missing or out of range
+     */
+    onyx::Exception mismatch(const std::string & message) {
+        return onyx::Exception(message, 400);
+    }
+}
+
+onyx::fastjson::Document::Document(boost::string_view json) : m_json(json) {
+    if (json.size() >= std::numeric_limits<uint32_t>::max())
+        throw invalid("document is too large");
+    buildIndex();
+    validate();
+}
+
+void onyx::fastjson::Document::buildIndex() {
+    const char * data = m_json.data();
+    size_t size = m_json.size();
+    m_index.reserve(size / 8 + 16);
+    uint64_t prev_escaped = 0;
+    uint64_t prev_in_string = 0;
+    uint64_t prev_other = 0;
+    char tail[64];
+
+    for (size_t base = 0; base < size; base += 64) {
+        const char * block = data + base;
+        if (size - base < 64) {
+            memset(tail, ' ', sizeof (tail));
+            memcpy(tail, block, size - base);
+            block = tail;
+        }
+        BlockMasks masks;
+        classify(block, masks);
+
+        // a backslash escapes the next byte unless it is escaped itself
+        uint64_t escaped = prev_escaped;
+        prev_escaped = 0;
+        uint64_t backslash = masks.backslash;
+        while (backslash != 0) {
+            int i = __builtin_ctzll(backslash);
+            backslash &= backslash - 1;
+            if (escaped & (uint64_t(1) << i))
+                continue;
+            if (i == 63)
+                prev_escaped = 1;
+            else
+                escaped |= uint64_t(1) << (i + 1);
+        }
+
+        uint64_t quotes = masks.quote & ~escaped;
+        uint64_t in_string = prefix_xor(quotes) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t> (static_cast<int64_t> (in_string) >> 63);
+
+        uint64_t structural = masks.structural & ~in_string;
+        uint64_t open_quotes = quotes & in_string;
+        uint64_t other = ~(masks.whitespace | masks.structural | masks.quote) & ~in_string;
+        uint64_t scalar_starts = other & ~((other << 1) | prev_other);
+        prev_other = other >> 63;
+
+        uint64_t bits = structural | open_quotes | scalar_starts;
+        while (bits != 0) {
+            m_index.push_back(static_cast<uint32_t> (base + __builtin_ctzll(bits)));
+            bits &= bits - 1;
+        }
+    }
+    if (prev_in_string != 0)
+        throw invalid("unterminated string");
+}
+
+void onyx::fastjson::Document::validate() {
+    enum State {
+        VALUE, OBJECT_KEY_OR_END, OBJECT_KEY, OBJECT_COLON, OBJECT_COMMA_OR_END, ARRAY_VALUE_OR_END, ARRAY_COMMA_OR_END, DONE
+    };
+    if (m_index.empty())
+        throw invalid("empty document");
+    m_close.assign(m_index.size(), 0);
+    std::vector<uint32_t> stack;
+    State state = VALUE;
+
+    auto after_value = [&]() {
+        if (stack.empty())
+            return DONE;
+        return m_json[m_index[stack.back()]] == '{' ? OBJECT_COMMA_OR_END : ARRAY_COMMA_OR_END;
+    };
+    // strings are decoded on demand, their escapes and control characters are checked here
+    auto check_string = [&](uint32_t k) {
+        boost::string_view raw = Value(this, k).token();
+        const char * error = string_error(raw.substr(1, raw.size() - 2));
+        if (error != nullptr)
+            throw invalid(std::string(error) + " at " + std::to_string(m_index[k]));
+    };
+    auto close = [&](uint32_t k, char expected) {
+        if (stack.empty() || m_json[m_index[stack.back()]] != expected)
+            throw invalid("unbalanced brackets");
+        m_close[stack.back()] = k;
+        stack.pop_back();
+        return after_value();
+    };
+
+    for (uint32_t k = 0; k < m_index.size(); k++) {
+        char ch = m_json[m_index[k]];
+        switch (state) {
+            case ARRAY_VALUE_OR_END:
+                if (ch == ']') {
+                    state = close(k, '[');
+                    break;
+                }
+                // fallthrough
+            case VALUE:
+                if (ch == '{' || ch == '[') {
+                    if (stack.size() == MAX_DEPTH)
+                        throw invalid("document is too deep");
+                    stack.push_back(k);
+                    state = ch == '{' ? OBJECT_KEY_OR_END : ARRAY_VALUE_OR_END;
+                } else if (ch == '"') {
+                    check_string(k);
+                    state = after_value();
+                } else if (ch == '}' || ch == ']' || ch == ':' || ch == ',') {
+                    throw invalid(std::string("unexpected '") + ch + "' at " + std::to_string(m_index[k]));
+                } else {
+                    boost::string_view token = Value(this, k).token();
+                    if (token != "true" && token != "false" && token != "null" && !is_number(token))
+                        throw invalid("unexpected token '" + token.to_string() + "' at " + std::to_string(m_index[k]));
+                    state = after_value();
+                }
+                break;
+            case OBJECT_KEY_OR_END:
+                if (ch == '}') {
+                    state = close(k, '{');
+                    break;
+                }
+                // fallthrough
+            case OBJECT_KEY:
+                if (ch != '"')
+                    throw invalid("expected key at " + std::to_string(m_index[k]));
+                check_string(k);
+                state = OBJECT_COLON;
+                break;
+            case OBJECT_COLON:
+                if (ch != ':')
+                    throw invalid("expected ':' at " + std::to_string(m_index[k]));
+                state = VALUE;
+                break;
+            case OBJECT_COMMA_OR_END:
+                if (ch == ',')
+                    state = OBJECT_KEY;
+                else if (ch == '}')
+                    state = close(k, '{');
+                else
+                    throw invalid("expected ',' or '}' at " + std::to_string(m_index[k]));
+                break;
+            case ARRAY_COMMA_OR_END:
+                if (ch == ',')
+                    state = VALUE;
+                else if (ch == ']')
+                    state = close(k, '[');
+                else
+                    throw invalid("expected ',' or ']' at " + std::to_string(m_index[k]));
+                break;
+            case DONE:
+                throw invalid("unexpected data after the document at " + std::to_string(m_index[k]));
+        }
+    }
+    if (state != DONE)
+        throw invalid("unexpected end of document");
+}
+
+std::string onyx::fastjson::Document::unescape(boost::string_view raw) {
+    std::string out;
+    out.reserve(raw.size());
+    size_t i = 0;
+    while (i < raw.size()) {
+        size_t run = i;
+        while (run < raw.size() && raw[run] != '\\' && static_cast<unsigned char> (raw[run]) >= 0x20)
+            run++;
+        out.append(raw.data() + i, run - i);
+        i = run;
+        if (i == raw.size())
+            break;
+        if (raw[i] != '\\')
+            throw invalid("control character in string");
+        if (++i == raw.size())
+            throw invalid("invalid escape");
+        char ch = raw[i++];
+        switch (ch) {
+            case '"': out += '"';
+                break;
+            case '\\': out += '\\';
+                break;
+            case '/': out += '/';
+                break;
+            case 'b': out += '\b';
+                break;
+            case 'f': out += '\f';
+                break;
+            case 'n': out += '\n';
+                break;
+            case 'r': out += '\r';
+                break;
+            case 't': out += '\t';
+                break;
+            case 'u':
+            {
+                uint32_t code;
+                if (!read_hex4(raw, i, code))
+                    throw invalid("invalid \\u escape");
+                i += 4;
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    uint32_t low;
+                    if (i + 1 >= raw.size() || raw[i] != '\\' || raw[i + 1] != 'u' || !read_hex4(raw, i + 2, low) || low < 0xDC00 || low > 0xDFFF)
+                        throw invalid("invalid surrogate pair");
+                    i += 6;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                } else if (code >= 0xDC00 && code <= 0xDFFF)
+                    throw invalid("invalid surrogate pair");
+                append_utf8(out, code);
+                break;
+            }
+            default:
+                throw invalid("invalid escape");
+        }
+    }
+    return out;
+}
+
+boost::string_view onyx::fastjson::Value::token() const {
+    const boost::string_view & json = m_document->m_json;
+    size_t begin = m_document->m_index[m_index];
+    size_t end = m_index + 1 < m_document->m_index.size() ? m_document->m_index[m_index + 1] : json.size();
+    while (end > begin + 1 && is_whitespace(json[end - 1]))
+        end--;
+    return json.substr(begin, end - begin);
+}
+
+uint32_t onyx::fastjson::Value::next(uint32_t index) const {
+    char ch = m_document->m_json[m_document->m_index[index]];
+    if (ch == '{' || ch == '[')
+        return m_document->m_close[index] + 1;
+    return index + 1;
+}
+
+onyx::fastjson::Type onyx::fastjson::Value::type() const {
+    if (m_document == nullptr)
+        throw mismatch("Empty JSON value");
+    switch (m_document->m_json[m_document->m_index[m_index]]) {
+        case '{': return Type::OBJECT;
+        case '[': return Type::ARRAY;
+        case '"': return Type::STRING;
+        case 't': case 'f': return Type::BOOLEAN;
+        case 'n': return Type::NONE;
+        default: return Type::NUMBER;
+    }
+}
+
+size_t onyx::fastjson::Value::size() const {
+    size_t count = 0;
+    if (isObject())
+        forEachMember([&count](boost::string_view, const Value &) {
+            count++;
+            return true;
+        });
+    else
+        forEachElement([&count](const Value &) {
+            count++;
+            return true;
+        });
+    return count;
+}
+
+void onyx::fastjson::Value::forEachMember(const std::function<bool(boost::string_view key, const Value & value)> & callback) const {
+    if (!isObject())
+        throw mismatch("JSON value isn't an object");
+    const boost::string_view & json = m_document->m_json;
+    const std::vector<uint32_t> & index = m_document->m_index;
+    uint32_t k = m_index + 1;
+    if (json[index[k]] == '}')
+        return;
+    for (;;) {
+        Value key(m_document, k);
+        Value value(m_document, k + 2);
+        if (!callback(key.getRawString(), value))
+            return;
+        k = next(k + 2);
+        if (json[index[k]] == '}')
+            return;
+        k++;
+    }
+}
+
+void onyx::fastjson::Value::forEachElement(const std::function<bool(const Value & value)> & callback) const {
+    if (!isArray())
+        throw mismatch("JSON value isn't an array");
+    const boost::string_view & json = m_document->m_json;
+    const std::vector<uint32_t> & index = m_document->m_index;
+    uint32_t k = m_index + 1;
+    if (json[index[k]] == ']')
+        return;
+    for (;;) {
+        if (!callback(Value(m_document, k)))
+            return;
+        k = next(k);
+        if (json[index[k]] == ']')
+            return;
+        k++;
+    }
+}
+
+bool onyx::fastjson::Value::find(boost::string_view key, Value & value) const {
+    bool found = false;
+    forEachMember([&](boost::string_view raw, const Value & member) {
+        if (raw.find('\\') == boost::string_view::npos ? raw == key : Document::unescape(raw) == key) {
+            value = member;
+            found = true;
+            return false;
+        }
+        return true;
+    });
+    return found;
+}
+
+onyx::fastjson::Value onyx::fastjson::Value::operator[](boost::string_view key) const {
+    Value value;
+    if (!find(key, value))
+        throw mismatch("Key " + key.to_string() + " doesn't exists in the JSON object");
+    return value;
+}
+
+bool onyx::fastjson::Value::find(size_t index, Value & value) const {
+    bool found = false;
+    size_t i = 0;
+    forEachElement([&](const Value & element) {
+        if (i++ == index) {
+            value = element;
+            found = true;
+            return false;
+        }
+        return true;
+    });
+    return found;
+}
+
+onyx::fastjson::Value onyx::fastjson::Value::at(size_t index) const {
+    Value value;
+    if (!find(index, value))
+        throw mismatch("Index doesn't exists in the JSON array");
+    return value;
+}
+
+bool onyx::fastjson::Value::findPointer(boost::string_view pointer, Value & value) const {
+    Value current = *this;
+    if (!pointer.empty() && pointer[0] != '/')
+        return false;
+    while (!pointer.empty()) {
+        pointer.remove_prefix(1);
+        size_t end = pointer.find('/');
+        boost::string_view raw = pointer.substr(0, end);
+        pointer = end == boost::string_view::npos ? boost::string_view() : pointer.substr(end);
+        std::string token;
+        for (size_t i = 0; i < raw.size(); i++) {
+            if (raw[i] == '~' && i + 1 < raw.size() && (raw[i + 1] == '0' || raw[i + 1] == '1')) {
+                token += raw[i + 1] == '0' ? '~' : '/';
+                i++;
+            } else
+                token += raw[i];
+        }
+        Type type = current.type();
+        if (type == Type::OBJECT) {
+            if (!current.find(token, current))
+                return false;
+        } else if (type == Type::ARRAY) {
+            if (token.empty() || token.size() > 9 || (token.size() > 1 && token[0] == '0') || token.find_first_not_of("0123456789") != std::string::npos)
+                return false;
+            if (!current.find(static_cast<size_t> (std::stoul(token)), current))
+                return false;
+        } else
+            return false;
+    }
+    value = current;
+    return true;
+}
+
+onyx::fastjson::Value onyx::fastjson::Value::atPointer(boost::string_view pointer) const {
+    Value value;
+    if (!findPointer(pointer, value))
+        throw mismatch("JSON pointer " + pointer.to_string() + " doesn't exists");
+    return value;
+}
+
+boost::string_view onyx::fastjson::Value::getRaw() const {
+    if (isObject() || isArray()) {
+        size_t begin = m_document->m_index[m_index];
+        size_t end = m_document->m_index[m_document->m_close[m_index]] + 1;
+        return m_document->m_json.substr(begin, end - begin);
+    }
+    return token();
+}
+
+boost::string_view onyx::fastjson::Value::getRawString() const {
+    if (!isString())
+        throw mismatch("JSON value isn't a string");
+    boost::string_view raw = token();
+    return raw.substr(1, raw.size() - 2);
+}
+
+std::string onyx::fastjson::Value::getString() const {
+    return Document::unescape(getRawString());
+}
+
+bool onyx::fastjson::Value::getBool() const {
+    if (!isBool())
+        throw mismatch("JSON value isn't a boolean");
+    return token()[0] == 't';
+}
+
+uint64_t onyx::fastjson::Value::getUint64() const {
+    if (!isNumber())
+        throw mismatch("JSON value isn't a number");
+    boost::string_view raw = token();
+    uint64_t result = 0;
+    for (char ch : raw) {
+        if (!is_digit(ch))
+            throw mismatch("JSON number isn't an unsigned integer");
+        uint64_t digit = ch - '0';
+        if (result > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+            throw mismatch("JSON number is out of range");
+        result = result * 10 + digit;
+    }
+    return result;
+}
+
+int64_t onyx::fastjson::Value::getInt64() const {
+    if (!isNumber())
+        throw mismatch("JSON value isn't a number");
+    boost::string_view raw = token();
+    bool negative = raw[0] == '-';
+    if (negative)
+        raw.remove_prefix(1);
+    uint64_t limit = negative ? uint64_t(std::numeric_limits<int64_t>::max()) + 1 : uint64_t(std::numeric_limits<int64_t>::max());
+    uint64_t result = 0;
+    for (char ch : raw) {
+        if (!is_digit(ch))
+            throw mismatch("JSON number isn't an integer");
+        uint64_t digit = ch - '0';
+        if (result > (limit - digit) / 10)
+            throw mismatch("JSON number is out of range");
+        result = result * 10 + digit;
+    }
+    return negative ? static_cast<int64_t> (0 - result) : static_cast<int64_t> (result);
+}
+
+double onyx::fastjson::Value::getDouble() const {
+    if (!isNumber())
+        throw mismatch("JSON value isn't a number");
+    // the C locale, the decimal point of the process locale may be a comma
+    static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t> (0));
+    std::string raw = token().to_string();
+    double result = strtod_l(raw.c_str(), nullptr, c_locale);
+    if (result == HUGE_VAL || result == -HUGE_VAL)
+        throw mismatch("JSON number is out of range");
+    return result;
+}
+
+int onyx::fastjson::Value::numberKind() const {
+    boost::string_view raw = token();
+    if (raw.find_first_of(".eE") != boost::string_view::npos)
+        return 0;
+    // 18 digits always fit into int64_t
+    size_t digits = raw.size() - (raw[0] == '-' ? 1 : 0);
+    if (digits <= 18)
+        return raw[0] == '-' ? 1 : 2;
+    try {
+        if (raw[0] == '-')
+            getInt64();
+        else
+            getUint64();
+    } catch (const onyx::Exception &) {
+        return 0;
+    }
+    return raw[0] == '-' ? 1 : 2;
+}
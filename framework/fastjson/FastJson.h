@@ -0,0 +1,231 @@
+#ifndef FASTJSON_H
+#define FASTJSON_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <boost/utility/string_view.hpp>
+#include "../exception/Exception.h"
+#include "../common/json/json.hpp"
+
+namespace onyx {
+
+    namespace fastjson {
+
+        enum class Type {
+            OBJECT, ARRAY, STRING, NUMBER, BOOLEAN, NONE
+        };
+
+        class Document;
+
+        /*
+         * Lightweight handle of a value inside a Document, valid as long as the Document.
+         * Accessors throw onyx::Exception with code 400 when the value has another type, is out of range
+         * or a key/index is missing
+         */
+        class Value {
+        private:
+            const Document * m_document;
+            uint32_t m_index;
+
+            friend class Document;
+
+            Value(const Document * document, uint32_t index) : m_document(document), m_index(index) {
+            }
+
+            boost::string_view token() const;
+            uint32_t next(uint32_t index) const;
+            /*
+             * 0 - double, 1 - int64_t, 2 - uint64_t
+             */
+            int numberKind() const;
+
+            template<typename BasicJsonType>
+            void fill(BasicJsonType & result) const;
+
+        public:
+
+            Value() : m_document(nullptr), m_index(0) {
+            }
+
+            Type type() const;
+
+            bool isObject() const {
+                return type() == Type::OBJECT;
+            }
+
+            bool isArray() const {
+                return type() == Type::ARRAY;
+            }
+
+            bool isString() const {
+                return type() == Type::STRING;
+            }
+
+            bool isNumber() const {
+                return type() == Type::NUMBER;
+            }
+
+            bool isBool() const {
+                return type() == Type::BOOLEAN;
+            }
+
+            bool isNull() const {
+                return type() == Type::NONE;
+            }
+
+            /*
+             * number of members of an object or elements of an array
+             */
+            size_t size() const;
+
+            /*
+             * member of an object, find returns false when it is missing
+             */
+            bool find(boost::string_view key, Value & value) const;
+            Value operator[](boost::string_view key) const;
+            Value operator[](const char * key) const {
+                return (*this)[boost::string_view(key)];
+            }
+
+            /*
+             * element of an array
+             */
+            bool find(size_t index, Value & value) const;
+            Value at(size_t index) const;
+
+            /*
+             * callback(key, value) for every member, key is still escaped (see unescape).
+             * Return false from the callback to stop
+             */
+            void forEachMember(const std::function<bool(boost::string_view key, const Value & value)> & callback) const;
+
+            /*
+             * callback(value) for every element, return false to stop
+             */
+            void forEachElement(const std::function<bool(const Value & value)> & callback) const;
+
+            /*
+             * RFC 6901 JSON pointer relative to this value, e.g. "/items/0/id"
+             */
+            bool findPointer(boost::string_view pointer, Value & value) const;
+            Value atPointer(boost::string_view pointer) const;
+
+            std::string getString() const;
+
+            /*
+             * string content as in the document, escapes not decoded
+             */
+            boost::string_view getRawString() const;
+
+            int64_t getInt64() const;
+            uint64_t getUint64() const;
+            double getDouble() const;
+            bool getBool() const;
+
+            /*
+             * text of the value as in the document
+             */
+            boost::string_view getRaw() const;
+
+            /*
+             * build a DOM of the value
+             */
+            template<typename BasicJsonType = nlohmann::json>
+            BasicJsonType toJson() const {
+                BasicJsonType result;
+                fill(result);
+                return result;
+            }
+        };
+
+        /*
+         * JSON parser with a vectorized structural indexing pass (simdjson style): every 64-byte block is
+         * classified with AVX2 (selected at run time) or SSE2, strings are masked with a prefix xor, and the
+         * positions of structural characters and scalars are stored in an index. The document is then
+         * validated over the index and values are navigated on demand, nothing is decoded before it is read.
+         * The input is not copied and must outlive the Document.
+         * Throws onyx::Exception with code 400 on invalid JSON
+         */
+        class Document {
+        private:
+            boost::string_view m_json;
+            std::vector<uint32_t> m_index;
+            std::vector<uint32_t> m_close;
+
+            friend class Value;
+
+            void buildIndex();
+            void validate();
+
+        public:
+
+            static const size_t MAX_DEPTH = 1024;
+
+            explicit Document(boost::string_view json);
+
+            Value root() const {
+                return Value(this, 0);
+            }
+
+            Value atPointer(boost::string_view pointer) const {
+                return root().atPointer(pointer);
+            }
+
+            template<typename BasicJsonType = nlohmann::json>
+            BasicJsonType toJson() const {
+                return root().toJson<BasicJsonType>();
+            }
+
+            /*
+             * decode the escapes of a JSON string content
+             */
+            static std::string unescape(boost::string_view raw);
+        };
+
+        template<typename BasicJsonType>
+        void Value::fill(BasicJsonType & result) const {
+            switch (type()) {
+                case Type::OBJECT:
+                    result = BasicJsonType::object();
+                    forEachMember([&result](boost::string_view key, const Value & value) {
+                        value.fill(result[Document::unescape(key)]);
+                        return true;
+                    });
+                    break;
+                case Type::ARRAY:
+                    result = BasicJsonType::array();
+                    forEachElement([&result](const Value & value) {
+                        result.push_back(nullptr);
+                        value.fill(result.back());
+                        return true;
+                    });
+                    break;
+                case Type::STRING:
+                    result = getString();
+                    break;
+                case Type::BOOLEAN:
+                    result = getBool();
+                    break;
+                case Type::NONE:
+                    result = nullptr;
+                    break;
+                case Type::NUMBER:
+                    switch (numberKind()) {
+                        case 1:
+                            result = getInt64();
+                            break;
+                        case 2:
+                            result = getUint64();
+                            break;
+                        default:
+                            result = getDouble();
+                    }
+                    break;
+            }
+        }
+    }
+}
+
+#endif
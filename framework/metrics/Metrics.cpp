@@ -0,0 +1,284 @@
+#include "Metrics.h"
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include "../security/Security.h"
+#include "../response/BaseResponse.h"
+
+onyx::Metrics * onyx::Metrics::m_instance = nullptr;
+
+const size_t onyx::Metrics::Histogram::SUB_BUCKETS;
+const size_t onyx::Metrics::Histogram::BUCKETS;
+const size_t onyx::Metrics::RouteMetrics::STATUSES;
+
+namespace {
+
+    /*
+     * Prometheus buckets end at powers of two of nanoseconds, from 2^10 (1 us) to 2^35 (34 s),
+     * so each one is a whole number of histogram buckets
+     */
+    const size_t FIRST_EXPONENT = 10;
+    const size_t LAST_EXPONENT = 35;
+
+    /*
+     * statuses counted by code
+     */
+    const unsigned STATUS_CODES[] = {200, 201, 204, 301, 302, 304, 400, 401, 403, 404, 405, 409, 422, 429, 500, 502, 503, 504};
+    const size_t STATUS_CODE_COUNT = sizeof (STATUS_CODES) / sizeof (STATUS_CODES[0]);
+
+    std::string escape(const std::string & value) {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (char ch : value) {
+            if (ch == '\\' || ch == '"')
+                escaped += '\\';
+            if (ch == '\n') {
+                escaped += "\\n";
+                continue;
+            }
+            escaped += ch;
+        }
+        return escaped;
+    }
+
+    std::string seconds(uint64_t ns) {
+        char buffer[32];
+        snprintf(buffer, sizeof (buffer), "%.9g", ns / 1e9);
+        return buffer;
+    }
+
+    void renderHistogram(std::string & out, const std::string & name, const std::string & labels, const std::vector<uint64_t> & counts, uint64_t sum) {
+        std::string prefix = labels.empty() ? "{" : "{" + labels + ",";
+        uint64_t total = 0;
+        size_t index = 0;
+        for (size_t exponent = FIRST_EXPONENT; exponent <= LAST_EXPONENT; exponent++) {
+            // the buckets below 2^exponent ns
+            size_t end = (exponent - 2) * onyx::Metrics::Histogram::SUB_BUCKETS;
+            for (; index < end; index++)
+                total += counts[index];
+            out += name + "_bucket" + prefix + "le=\"" + seconds(uint64_t(1) << exponent) + "\"} " + std::to_string(total) + "\n";
+        }
+        for (; index < counts.size(); index++)
+            total += counts[index];
+        out += name + "_bucket" + prefix + "le=\"+Inf\"} " + std::to_string(total) + "\n";
+        std::string suffix = labels.empty() ? "" : "{" + labels + "}";
+        out += name + "_sum" + suffix + " " + seconds(sum) + "\n";
+        out += name + "_count" + suffix + " " + std::to_string(total) + "\n";
+    }
+}
+
+onyx::Metrics::Histogram::Histogram() : m_sum(0) {
+    for (size_t i = 0; i < BUCKETS; i++)
+        m_counts[i].store(0, std::memory_order_relaxed);
+}
+
+void onyx::Metrics::Histogram::merge(std::vector<uint64_t> & counts, uint64_t & sum) const {
+    for (size_t i = 0; i < BUCKETS; i++)
+        counts[i] += m_counts[i].load(std::memory_order_relaxed);
+    sum += m_sum.load(std::memory_order_relaxed);
+}
+
+onyx::Metrics::RouteMetrics::RouteMetrics() : m_in_flight(0) {
+    static_assert(STATUSES == STATUS_CODE_COUNT + 5, "a counter per status code and per class");
+    for (auto & status : m_status)
+        status.store(0, std::memory_order_relaxed);
+}
+
+onyx::Metrics::ThreadMetrics::ThreadMetrics(size_t route_count) :
+m_routes(new std::atomic<RouteMetrics *>[route_count]), m_route_count(route_count), m_unmatched(0) {
+    for (size_t i = 0; i < route_count; i++)
+        m_routes[i].store(nullptr, std::memory_order_relaxed);
+}
+
+onyx::Metrics::ThreadMetrics::~ThreadMetrics() {
+    for (size_t i = 0; i < m_route_count; i++)
+        delete m_routes[i].load(std::memory_order_relaxed);
+}
+
+onyx::Metrics::RouteMetrics & onyx::Metrics::ThreadMetrics::route(size_t index) {
+    RouteMetrics * route = m_routes[index].load(std::memory_order_relaxed);
+    if (route == nullptr) {
+        // published to render() with its counters zeroed
+        route = new RouteMetrics;
+        m_routes[index].store(route, std::memory_order_release);
+    }
+    return *route;
+}
+
+size_t onyx::Metrics::statusIndex(unsigned status) {
+    if (status < 100 || status >= 600)
+        return RouteMetrics::STATUSES;
+    for (size_t i = 0; i < STATUS_CODE_COUNT; i++) {
+        if (STATUS_CODES[i] == status)
+            return i;
+    }
+    return STATUS_CODE_COUNT + status / 100 - 1;
+}
+
+std::string onyx::Metrics::statusLabel(size_t index) {
+    if (index < STATUS_CODE_COUNT)
+        return std::to_string(STATUS_CODES[index]);
+    return std::to_string(index - STATUS_CODE_COUNT + 1) + "xx";
+}
+
+onyx::Metrics::Metrics() {
+    m_enabled = false;
+}
+
+void onyx::Metrics::addRoute(const std::string & method, const std::string & regex) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_routes.push_back({method, regex});
+}
+
+onyx::Metrics::ThreadMetrics & onyx::Metrics::local() {
+    static thread_local ThreadMetrics * metrics = nullptr;
+    if (metrics == nullptr) {
+        // kept after the thread exits, its requests stay counted
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_threads.emplace_back(new ThreadMetrics(m_routes.size()));
+        metrics = m_threads.back().get();
+    }
+    return *metrics;
+}
+
+onyx::Metrics::Scope::Scope(Metrics * metrics, size_t route, uint64_t start) :
+m_metrics(metrics), m_route(route), m_start(start), m_status(500) {
+    ThreadMetrics & local = m_metrics->local();
+    if (m_route >= local.m_route_count)
+        return;
+    std::atomic<int64_t> & in_flight = local.route(m_route).m_in_flight;
+    in_flight.store(in_flight.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+onyx::Metrics::Scope::~Scope() {
+    ThreadMetrics & local = m_metrics->local();
+    if (m_route >= local.m_route_count)
+        return;
+    RouteMetrics & route = local.route(m_route);
+    route.m_duration.record(now() - m_start);
+    size_t status = statusIndex(m_status);
+    if (status < RouteMetrics::STATUSES)
+        increment(route.m_status[status]);
+    route.m_in_flight.store(route.m_in_flight.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+}
+
+void onyx::Metrics::Scope::setResponse(const std::string & response, const ResponseWriter * writer) {
+    // a streamed response returns an empty string, its headers went through the writer
+    if (response.empty() && writer != nullptr && writer->getStatus() != 0)
+        m_status = writer->getStatus();
+    else
+        m_status = BaseResponse::parseStatus(response);
+}
+
+void onyx::Metrics::recordUnmatched() {
+    increment(local().m_unmatched);
+}
+
+void onyx::Metrics::recordQueueTime(const char * request_start) {
+    if (request_start == nullptr)
+        return;
+    if (strncmp(request_start, "t=", 2) == 0)
+        request_start += 2;
+    double start = strtod(request_start, nullptr);
+    // nginx $msec is in seconds, other servers send milliseconds or microseconds
+    if (start > 1e14)
+        start /= 1e6;
+    else if (start > 1e11)
+        start /= 1e3;
+    double current = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count() / 1e9;
+    if (start <= 0 || start > current)
+        return;
+    local().m_queue.record(static_cast<uint64_t> ((current - start) * 1e9));
+}
+
+void onyx::Metrics::recordSessionFetch(uint64_t ns) {
+    local().m_session_fetch.record(ns);
+}
+
+std::string onyx::Metrics::render() const {
+    std::vector<Route> routes;
+    size_t route_count;
+    std::vector<std::vector<uint64_t>> durations;
+    std::vector<uint64_t> duration_sums;
+    std::vector<std::vector<uint64_t>> statuses;
+    std::vector<int64_t> in_flight;
+    std::vector<uint64_t> queue(Histogram::BUCKETS, 0), session_fetch(Histogram::BUCKETS, 0);
+    uint64_t queue_sum = 0, session_fetch_sum = 0, unmatched = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        routes = m_routes;
+        route_count = routes.size();
+        durations.assign(route_count, std::vector<uint64_t>(Histogram::BUCKETS, 0));
+        duration_sums.assign(route_count, 0);
+        statuses.assign(route_count, std::vector<uint64_t>(RouteMetrics::STATUSES, 0));
+        in_flight.assign(route_count, 0);
+        for (auto & thread : m_threads) {
+            for (size_t i = 0; i < thread->m_route_count && i < route_count; i++) {
+                const RouteMetrics * route = thread->m_routes[i].load(std::memory_order_acquire);
+                if (route == nullptr)
+                    continue;
+                route->m_duration.merge(durations[i], duration_sums[i]);
+                for (size_t status = 0; status < RouteMetrics::STATUSES; status++)
+                    statuses[i][status] += route->m_status[status].load(std::memory_order_relaxed);
+                in_flight[i] += route->m_in_flight.load(std::memory_order_relaxed);
+            }
+            thread->m_queue.merge(queue, queue_sum);
+            thread->m_session_fetch.merge(session_fetch, session_fetch_sum);
+            unmatched += thread->m_unmatched.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::string out;
+    out += "# HELP onyx_request_duration_seconds Time to process a request by route.\n";
+    out += "# TYPE onyx_request_duration_seconds histogram\n";
+    for (size_t i = 0; i < route_count; i++)
+        renderHistogram(out, "onyx_request_duration_seconds", "method=\"" + escape(routes[i].m_method) + "\",route=\"" + escape(routes[i].m_regex) + "\"", durations[i], duration_sums[i]);
+
+    out += "# HELP onyx_requests_total Requests processed by route and status.\n";
+    out += "# TYPE onyx_requests_total counter\n";
+    for (size_t i = 0; i < route_count; i++) {
+        for (size_t status = 0; status < RouteMetrics::STATUSES; status++) {
+            if (statuses[i][status] != 0)
+                out += "onyx_requests_total{method=\"" + escape(routes[i].m_method) + "\",route=\"" + escape(routes[i].m_regex) + "\",status=\"" + statusLabel(status) + "\"} " + std::to_string(statuses[i][status]) + "\n";
+        }
+    }
+
+    out += "# HELP onyx_requests_unmatched_total Requests matching no route.\n";
+    out += "# TYPE onyx_requests_unmatched_total counter\n";
+    out += "onyx_requests_unmatched_total " + std::to_string(unmatched) + "\n";
+
+    out += "# HELP onyx_requests_in_flight Requests being processed by route.\n";
+    out += "# TYPE onyx_requests_in_flight gauge\n";
+    for (size_t i = 0; i < route_count; i++)
+        out += "onyx_requests_in_flight{method=\"" + escape(routes[i].m_method) + "\",route=\"" + escape(routes[i].m_regex) + "\"} " + std::to_string(in_flight[i]) + "\n";
+
+    out += "# HELP onyx_request_queue_seconds Time a request waited for a worker.\n";
+    out += "# TYPE onyx_request_queue_seconds histogram\n";
+    renderHistogram(out, "onyx_request_queue_seconds", "", queue, queue_sum);
+
+    out += "# HELP onyx_session_fetch_seconds Time to load a session missing from the cache.\n";
+    out += "# TYPE onyx_session_fetch_seconds histogram\n";
+    renderHistogram(out, "onyx_session_fetch_seconds", "", session_fetch, session_fetch_sum);
+
+    onyx::Security * security = onyx::Security::getInstance();
+    if (security->getSessionCache() != nullptr) {
+        out += "# HELP onyx_session_cache_hits_total Sessions found in the cache.\n";
+        out += "# TYPE onyx_session_cache_hits_total counter\n";
+        out += "onyx_session_cache_hits_total " + std::to_string(security->getSessionCache()->getHits()) + "\n";
+        out += "# HELP onyx_session_cache_misses_total Sessions missing from the cache.\n";
+        out += "# TYPE onyx_session_cache_misses_total counter\n";
+        out += "onyx_session_cache_misses_total " + std::to_string(security->getSessionCache()->getMisses()) + "\n";
+    }
+    std::shared_ptr<const SessionFilter> filter = security->getSessionFilter();
+    if (filter) {
+        out += "# HELP onyx_session_filter_rejected_total Session ids rejected by the filter.\n";
+        out += "# TYPE onyx_session_filter_rejected_total counter\n";
+        out += "onyx_session_filter_rejected_total " + std::to_string(security->getSessionFilterRejected()) + "\n";
+        out += "# HELP onyx_session_filter_false_positive_rate Estimated false positive rate of the filter.\n";
+        out += "# TYPE onyx_session_filter_false_positive_rate gauge\n";
+        char buffer[32];
+        snprintf(buffer, sizeof (buffer), "%.6g", filter->getFalsePositiveRate());
+        out += std::string("onyx_session_filter_false_positive_rate ") + buffer + "\n";
+    }
+    return out;
+}
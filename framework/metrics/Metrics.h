@@ -0,0 +1,186 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "../response/ResponseWriter.h"
+
+namespace onyx {
+
+    /*
+     * Request metrics in the Prometheus text format. Every thread records into counters of its own
+     * with plain loads and stores, render() sums the threads. Routes must be added before the
+     * threads record, a thread sizes its counters on its first record and allocates those of a route
+     * on its first request of the route. Common statuses are counted by code, the others by class
+     * (status="4xx")
+     */
+    class Metrics {
+    public:
+
+        /*
+         * log-linear histogram of nanoseconds: 8 buckets per power of two, values from 2^36 ns
+         * (about 69 s) share the last bucket. Only one thread records into a histogram
+         */
+        class Histogram {
+        public:
+            static const size_t SUB_BUCKETS = 8;
+            static const size_t BUCKETS = 34 * SUB_BUCKETS;
+
+            Histogram();
+
+            void record(uint64_t ns) {
+                std::atomic<uint64_t> & count = m_counts[index(ns)];
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                m_sum.store(m_sum.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+            }
+
+            /*
+             * add the buckets and the sum of this histogram to counts (BUCKETS entries) and sum
+             */
+            void merge(std::vector<uint64_t> & counts, uint64_t & sum) const;
+
+            static size_t index(uint64_t ns) {
+                if (ns < SUB_BUCKETS)
+                    return ns;
+                size_t exponent = 63 - __builtin_clzll(ns);
+                size_t index = (exponent - 2) * SUB_BUCKETS + ((ns >> (exponent - 3)) & (SUB_BUCKETS - 1));
+                return index < BUCKETS ? index : BUCKETS - 1;
+            }
+
+        private:
+            std::atomic<uint64_t> m_counts[BUCKETS];
+            std::atomic<uint64_t> m_sum;
+        };
+
+        static Metrics * getInstance() noexcept {
+            if (m_instance == nullptr)
+                m_instance = new Metrics;
+            return m_instance;
+        }
+
+        static uint64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        bool isEnabled() const {
+            return m_enabled;
+        }
+
+        /*
+         * nothing is recorded until the metrics are enabled, before the application runs
+         */
+        void setEnabled(bool enabled) {
+            m_enabled = enabled;
+        }
+
+        /*
+         * called by the Dispatcher for every route, the route index is the order of the calls
+         */
+        void addRoute(const std::string & method, const std::string & regex);
+
+        /*
+         * records a request of a route from its construction to its destruction, a request
+         * left by an exception counts as status 500
+         */
+        class Scope {
+        private:
+            Metrics * m_metrics;
+            size_t m_route;
+            uint64_t m_start;
+            unsigned m_status;
+
+        public:
+            Scope(Metrics * metrics, size_t route, uint64_t start);
+            ~Scope();
+
+            /*
+             * status from the Status header of the response, 200 without one. The status of a response
+             * streamed to writer (the handler returned an empty string) is the one its headers were sent with
+             */
+            void setResponse(const std::string & response, const ResponseWriter * writer = nullptr);
+        };
+
+        void recordUnmatched();
+
+        /*
+         * time the request waited for a worker, from the REQUEST_START parameter or the
+         * X-Request-Start header set by the web server
+         */
+        void recordQueueTime(const char * request_start);
+
+        void recordSessionFetch(uint64_t ns);
+
+        std::string render() const;
+
+    private:
+
+        struct RouteMetrics {
+            /*
+             * the codes of statusIndex, then one counter per class
+             */
+            static const size_t STATUSES = 23;
+
+            Histogram m_duration;
+            std::atomic<uint64_t> m_status[STATUSES];
+            std::atomic<int64_t> m_in_flight;
+
+            RouteMetrics();
+        };
+
+        struct ThreadMetrics {
+            /*
+             * nullptr until the thread records a request of the route
+             */
+            std::unique_ptr<std::atomic<RouteMetrics *>[]> m_routes;
+            size_t m_route_count;
+            Histogram m_queue;
+            Histogram m_session_fetch;
+            std::atomic<uint64_t> m_unmatched;
+
+            explicit ThreadMetrics(size_t route_count);
+            ~ThreadMetrics();
+
+            /*
+             * called by the owning thread only
+             */
+            RouteMetrics & route(size_t index);
+        };
+
+        struct Route {
+            std::string m_method;
+            std::string m_regex;
+        };
+
+        static Metrics * m_instance;
+
+        bool m_enabled;
+        std::vector<Route> m_routes;
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<ThreadMetrics>> m_threads;
+
+        Metrics();
+
+        ThreadMetrics & local();
+
+        /*
+         * counter of a status in RouteMetrics::m_status, STATUSES outside 100-599
+         */
+        static size_t statusIndex(unsigned status);
+
+        /*
+         * label of a counter of RouteMetrics::m_status, "404" or "4xx"
+         */
+        static std::string statusLabel(size_t index);
+
+        static void increment(std::atomic<uint64_t> & counter) {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,288 @@
+#include "Multipart.h"
+
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../common/utils.h"
+
+namespace {
+
+    const size_t CHUNK_SIZE = 64 * 1024;
+
+    void write_all(int fd, const char * data, size_t size) {
+        while (size > 0) {
+            ssize_t written = write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw onyx::Exception(std::string("Can't write multipart temporary file: ") + strerror(errno));
+            }
+            data += written;
+            size -= written;
+        }
+    }
+
+    int open_tmp_file(const std::string & dir) {
+        int fd = open(dir.c_str(), O_TMPFILE | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0 && (errno == EISDIR || errno == EOPNOTSUPP || errno == EINVAL)) {
+            // the file system doesn't support O_TMPFILE
+            std::string path = dir + "/onyx-multipart-XXXXXX";
+            fd = mkstemp(&path[0]);
+            if (fd >= 0)
+                unlink(path.c_str());
+        }
+        if (fd < 0)
+            throw onyx::Exception(std::string("Can't create multipart temporary file: ") + strerror(errno));
+        return fd;
+    }
+
+    /*
+     * value of a parameter of a header like Content-Disposition: form-data; name="a"; filename="b"
+     */
+    std::string fetch_header_param(const std::string & header, const std::string & name) {
+        size_t pos = 0;
+        while ((pos = header.find(';', pos)) != std::string::npos) {
+            pos++;
+            while (pos < header.size() && (header[pos] == ' ' || header[pos] == '\t'))
+                pos++;
+            if (header.size() - pos <= name.size() || strncasecmp(header.c_str() + pos, name.c_str(), name.size()) != 0 || header[pos + name.size()] != '=')
+                continue;
+            pos += name.size() + 1;
+            std::string value;
+            if (pos < header.size() && header[pos] == '"') {
+                for (pos++; pos < header.size() && header[pos] != '"'; pos++) {
+                    if (header[pos] == '\\' && pos + 1 < header.size())
+                        pos++;
+                    value += header[pos];
+                }
+            } else {
+                size_t end = header.find(';', pos);
+                value = header.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+                onyx::utils::trim(value);
+            }
+            return value;
+        }
+        return "";
+    }
+}
+
+void onyx::multipart::Part::reset() {
+    if (m_fd >= 0)
+        close(m_fd);
+    m_fd = -1;
+    m_size = 0;
+    m_headers.clear();
+    m_name.clear();
+    m_filename.clear();
+    m_data.clear();
+}
+
+onyx::multipart::Part::Part(Part && part) noexcept : m_headers(std::move(part.m_headers)), m_name(std::move(part.m_name)), m_filename(std::move(part.m_filename)), m_data(std::move(part.m_data)), m_fd(part.m_fd), m_size(part.m_size) {
+    part.m_fd = -1;
+    part.m_size = 0;
+}
+
+onyx::multipart::Part & onyx::multipart::Part::operator=(Part && part) noexcept {
+    if (this != &part) {
+        reset();
+        m_headers = std::move(part.m_headers);
+        m_name = std::move(part.m_name);
+        m_filename = std::move(part.m_filename);
+        m_data = std::move(part.m_data);
+        m_fd = part.m_fd;
+        m_size = part.m_size;
+        part.m_fd = -1;
+        part.m_size = 0;
+    }
+    return *this;
+}
+
+onyx::multipart::Parser::Parser(const std::string & boundary, BodyReader reader, const Settings & settings) :
+m_reader(reader), m_settings(settings), m_delimiter("\r\n--" + boundary), m_buffer(std::max(CHUNK_SIZE, 2 * m_delimiter.size())),
+m_begin(0), m_end(0), m_eof(false), m_finished(false), m_started(false) {
+    if (boundary.empty())
+        throw onyx::Exception("Multipart boundary is undefined", 400);
+    // the first delimiter has no leading CRLF, pretend it has one
+    m_buffer[0] = '\r';
+    m_buffer[1] = '\n';
+    m_end = 2;
+}
+
+bool onyx::multipart::Parser::fill() {
+    if (m_eof)
+        return false;
+    if (m_begin > 0) {
+        memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        m_end -= m_begin;
+        m_begin = 0;
+    }
+    if (m_end == m_buffer.size())
+        return false;
+    size_t read = m_reader(m_buffer.data() + m_end, m_buffer.size() - m_end);
+    if (read == 0) {
+        m_eof = true;
+        return false;
+    }
+    m_end += read;
+    return true;
+}
+
+bool onyx::multipart::Parser::skipPreamble() {
+    for (;;) {
+        boost::string_view data = buffered();
+        const char * found = static_cast<const char *> (memmem(data.data(), data.size(), m_delimiter.data(), m_delimiter.size()));
+        if (found != nullptr) {
+            m_begin += found - data.data() + m_delimiter.size();
+            return true;
+        }
+        if (data.size() >= m_delimiter.size())
+            m_begin = m_end - (m_delimiter.size() - 1);
+        if (!fill())
+            return false;
+    }
+}
+
+void onyx::multipart::Parser::readHeaders(Part & part) {
+    const char * found;
+    for (;;) {
+        boost::string_view data = buffered();
+        if (data.size() >= 2 && data[0] == '\r' && data[1] == '\n') {
+            m_begin += 2;
+            return;
+        }
+        found = static_cast<const char *> (memmem(data.data(), data.size(), "\r\n\r\n", 4));
+        if (found != nullptr)
+            break;
+        if (!fill())
+            throw onyx::Exception(m_eof ? "Malformed multipart body: unexpected end of headers" : "Multipart headers are too large", 400);
+    }
+    const char * line = m_buffer.data() + m_begin;
+    const char * end = found + 2;
+    while (line < end) {
+        const char * eol = static_cast<const char *> (memmem(line, end - line, "\r\n", 2));
+        const char * colon = static_cast<const char *> (memchr(line, ':', eol - line));
+        if (colon != nullptr) {
+            std::string name(line, colon - line);
+            std::string value(colon + 1, eol - colon - 1);
+            onyx::utils::trim(name);
+            onyx::utils::trim(value);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            part.m_headers[name] = value;
+        }
+        line = eol + 2;
+    }
+    m_begin = found + 4 - m_buffer.data();
+    std::string disposition = part.getHeader("content-disposition");
+    part.m_name = fetch_header_param(disposition, "name");
+    part.m_filename = fetch_header_param(disposition, "filename");
+}
+
+void onyx::multipart::Parser::append(Part & part, const char * data, size_t size) {
+    if (size == 0)
+        return;
+    if (part.m_fd < 0 && part.m_data.size() + size > m_settings.memory_limit) {
+        part.m_fd = open_tmp_file(m_settings.tmp_dir);
+        write_all(part.m_fd, part.m_data.data(), part.m_data.size());
+        std::string().swap(part.m_data);
+    }
+    if (part.m_fd >= 0)
+        write_all(part.m_fd, data, size);
+    else
+        part.m_data.append(data, size);
+    part.m_size += size;
+}
+
+void onyx::multipart::Parser::readContent(Part & part) {
+    for (;;) {
+        boost::string_view data = buffered();
+        const char * found = static_cast<const char *> (memmem(data.data(), data.size(), m_delimiter.data(), m_delimiter.size()));
+        if (found != nullptr) {
+            append(part, data.data(), found - data.data());
+            m_begin += found - data.data() + m_delimiter.size();
+            break;
+        }
+        // the tail may be the beginning of a delimiter split between two reads
+        size_t safe = data.size() >= m_delimiter.size() ? data.size() - (m_delimiter.size() - 1) : 0;
+        append(part, data.data(), safe);
+        m_begin += safe;
+        if (!fill())
+            throw onyx::Exception("Malformed multipart body: unexpected end of part", 400);
+    }
+    if (part.m_fd >= 0)
+        lseek(part.m_fd, 0, SEEK_SET);
+}
+
+bool onyx::multipart::Parser::next(Part & part) {
+    if (!m_held.empty()) {
+        part = std::move(m_held.front());
+        m_held.pop_front();
+        return true;
+    }
+    return read(part);
+}
+
+const onyx::multipart::Part * onyx::multipart::Parser::peek(const std::string & name) {
+    for (const Part & part : m_held) {
+        if (part.m_name == name)
+            return &part;
+        if (!part.m_filename.empty())
+            return nullptr;
+    }
+    if (!m_held.empty() && !m_held.back().m_filename.empty())
+        return nullptr;
+    for (;;) {
+        Part part;
+        if (!read(part))
+            return nullptr;
+        // references to the held parts stay valid as the deque grows
+        m_held.push_back(std::move(part));
+        const Part & held = m_held.back();
+        if (held.m_name == name)
+            return &held;
+        if (!held.m_filename.empty())
+            return nullptr;
+    }
+}
+
+bool onyx::multipart::Parser::read(Part & part) {
+    part.reset();
+    if (m_finished)
+        return false;
+    if (!m_started) {
+        m_started = true;
+        if (!skipPreamble())
+            throw onyx::Exception("Malformed multipart body: boundary not found", 400);
+    }
+    while (buffered().size() < 2 && fill()) {
+    }
+    boost::string_view data = buffered();
+    if (data.size() >= 2 && data[0] == '-' && data[1] == '-') {
+        m_finished = true;
+        return false;
+    }
+    // transport padding after the delimiter
+    for (;;) {
+        data = buffered();
+        while (!data.empty() && (data[0] == ' ' || data[0] == '\t')) {
+            data.remove_prefix(1);
+            m_begin++;
+        }
+        if (data.size() >= 2 || !fill())
+            break;
+    }
+    if (data.size() < 2 || data[0] != '\r' || data[1] != '\n')
+        throw onyx::Exception("Malformed multipart body: invalid delimiter", 400);
+    m_begin += 2;
+    readHeaders(part);
+    readContent(part);
+    return true;
+}
+
+std::string onyx::multipart::Parser::fetchBoundary(const std::string & content_type) {
+    if (strncasecmp(content_type.c_str(), "multipart/", 10) != 0)
+        return "";
+    return fetch_header_param(content_type, "boundary");
+}
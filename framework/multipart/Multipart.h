@@ -0,0 +1,225 @@
+#ifndef MULTIPART_H
+#define MULTIPART_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <functional>
+#include <iterator>
+#include <boost/utility/string_view.hpp>
+#include "../exception/Exception.h"
+
+namespace onyx {
+
+    namespace multipart {
+
+        /*
+         * Reads up to size bytes of the request body into buffer, returns 0 at the end of the body
+         */
+        typedef std::function<size_t(char * buffer, size_t size)> BodyReader;
+
+        struct Settings {
+            /*
+             * parts bigger than this are spooled to a temporary file
+             */
+            size_t memory_limit = 1024 * 1024;
+            /*
+             * directory of the temporary files (opened with O_TMPFILE, nothing is left on disk)
+             */
+            std::string tmp_dir = "/tmp";
+        };
+
+        /*
+         * One part of a multipart/form-data body. Small parts are kept in memory,
+         * big ones in an unlinked temporary file which is closed with the part
+         */
+        class Part {
+        private:
+            std::map<std::string, std::string> m_headers;
+            std::string m_name;
+            std::string m_filename;
+            std::string m_data;
+            int m_fd;
+            size_t m_size;
+
+            friend class Parser;
+
+            void reset();
+        public:
+
+            Part() : m_fd(-1), m_size(0) {
+            }
+
+            Part(const Part &) = delete;
+            Part & operator=(const Part &) = delete;
+            Part(Part && part) noexcept;
+            Part & operator=(Part && part) noexcept;
+
+            ~Part() {
+                reset();
+            }
+
+            /*
+             * headers of the part, names are lowercase
+             */
+            const std::map<std::string, std::string> & getHeaders() const {
+                return m_headers;
+            }
+
+            std::string getHeader(const std::string & name) const {
+                auto it = m_headers.find(name);
+                if (it == m_headers.end())
+                    return "";
+                return it->second;
+            }
+
+            /*
+             * name and filename from Content-Disposition
+             */
+            std::string getName() const {
+                return m_name;
+            }
+
+            std::string getFilename() const {
+                return m_filename;
+            }
+
+            std::string getContentType() const {
+                return getHeader("content-type");
+            }
+
+            size_t size() const {
+                return m_size;
+            }
+
+            /*
+             * true when the content was spooled to disk, use getFd() then
+             */
+            bool isFile() const {
+                return m_fd >= 0;
+            }
+
+            /*
+             * content of an in-memory part
+             */
+            boost::string_view getData() const {
+                return m_data;
+            }
+
+            /*
+             * descriptor of a spooled part positioned at the beginning of the content
+             */
+            int getFd() const {
+                return m_fd;
+            }
+
+        };
+
+        /*
+         * Incremental multipart/form-data parser. Reads the body through BodyReader in fixed-size chunks,
+         * so memory use is bounded by the chunk size plus Settings::memory_limit whatever the body size.
+         * Throws onyx::Exception on a malformed body or when a temporary file can't be written
+         */
+        class Parser {
+        private:
+            BodyReader m_reader;
+            Settings m_settings;
+            std::string m_delimiter;
+            std::vector<char> m_buffer;
+            size_t m_begin;
+            size_t m_end;
+            bool m_eof;
+            bool m_finished;
+            bool m_started;
+            /*
+             * parts read by peek, next returns them first
+             */
+            std::deque<Part> m_held;
+
+            bool fill();
+            bool read(Part & part);
+            boost::string_view buffered() const {
+                return boost::string_view(m_buffer.data() + m_begin, m_end - m_begin);
+            }
+            bool skipPreamble();
+            void readHeaders(Part & part);
+            void readContent(Part & part);
+            void append(Part & part, const char * data, size_t size);
+
+        public:
+
+            Parser(const std::string & boundary, BodyReader reader, const Settings & settings = Settings());
+
+            /*
+             * read the next part, returns false after the last one
+             */
+            bool next(Part & part);
+
+            /*
+             * read ahead to the field called name, nullptr when the body ends or a file upload comes first.
+             * The parts read meanwhile are kept and still returned by next, e.g. a CSRF token is looked up
+             * before the handler reads the body
+             */
+            const Part * peek(const std::string & name);
+
+            /*
+             * for (auto & part : parser) { ... }
+             */
+            class iterator {
+            private:
+                Parser * m_parser;
+                Part m_part;
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef Part value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef Part * pointer;
+                typedef Part & reference;
+
+                explicit iterator(Parser * parser = nullptr) : m_parser(parser) {
+                    ++(*this);
+                }
+
+                iterator(iterator &&) = default;
+
+                iterator & operator++() {
+                    if (m_parser != nullptr && !m_parser->next(m_part))
+                        m_parser = nullptr;
+                    return *this;
+                }
+
+                Part & operator*() {
+                    return m_part;
+                }
+
+                Part * operator->() {
+                    return &m_part;
+                }
+
+                bool operator==(const iterator & other) const {
+                    return m_parser == other.m_parser;
+                }
+
+                bool operator!=(const iterator & other) const {
+                    return m_parser != other.m_parser;
+                }
+            };
+
+            iterator begin() {
+                return iterator(this);
+            }
+
+            iterator end() {
+                return iterator();
+            }
+
+            /*
+             * boundary parameter of a multipart Content-Type header or an empty string
+             */
+            static std::string fetchBoundary(const std::string & content_type);
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef JSONVISITOR_H
+#define JSONVISITOR_H
+
+#include <string>
+#include "../common/json/json.hpp"
+
+namespace onyx {
+
+    /*
+     * SAX handler for onyx::ONObject::visitJson with every event ignored by default,
+     * override only the events you need and return false from any of them to stop parsing
+    */
+
+    class JsonVisitor : public nlohmann::json_sax<nlohmann::json> {
+    private:
+        std::string m_error;
+    public:
+
+        virtual bool null() override {
+            return true;
+        }
+
+        virtual bool boolean(bool) override {
+            return true;
+        }
+
+        virtual bool number_integer(number_integer_t) override {
+            return true;
+        }
+
+        virtual bool number_unsigned(number_unsigned_t) override {
+            return true;
+        }
+
+        virtual bool number_float(number_float_t, const string_t &) override {
+            return true;
+        }
+
+        virtual bool string(string_t &) override {
+            return true;
+        }
+
+        virtual bool start_object(std::size_t) override {
+            return true;
+        }
+
+        virtual bool key(string_t &) override {
+            return true;
+        }
+
+        virtual bool end_object() override {
+            return true;
+        }
+
+        virtual bool start_array(std::size_t) override {
+            return true;
+        }
+
+        virtual bool end_array() override {
+            return true;
+        }
+
+        virtual bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception & ex) override {
+            m_error = ex.what();
+            return false;
+        }
+
+        /*
+         * message of the parse error, empty when the body was valid
+         */
+        std::string getError() const {
+            return m_error;
+        }
+    };
+}
+
+#endif
@@ -1,2 +1,103 @@
 #include "ONObject.h"
+#include <strings.h>
 
+bool onyx::ONObject::isContentType(boost::string_view media_type) const {
+    boost::string_view type(m_content_type);
+    size_t end = type.find(';');
+    if (end != boost::string_view::npos)
+        type = type.substr(0, end);
+    while (!type.empty() && type.back() == ' ')
+        type.remove_suffix(1);
+    if (type.size() != media_type.size())
+        return false;
+    return strncasecmp(type.data(), media_type.data(), type.size()) == 0;
+}
+
+onyx::ParamCollection & onyx::ONObject::getFormParams() {
+    if (!m_form_params) {
+        if (isContentType("application/x-www-form-urlencoded"))
+            m_form_params = std::make_shared<ParamCollection>(m_body);
+        else
+            m_form_params = std::make_shared<ParamCollection>("");
+    }
+    return *m_form_params;
+}
+
+onyx::multipart::Parser & onyx::ONObject::getMultipart() {
+    if (!m_multipart) {
+        std::string boundary = onyx::multipart::Parser::fetchBoundary(m_content_type);
+        if (boundary.empty())
+            throw onyx::Exception("Request body isn't multipart", 400);
+        onyx::multipart::BodyReader reader = m_body_reader;
+        if (!reader) {
+            boost::string_view body = m_body;
+            reader = [body](char * buffer, size_t size) mutable -> size_t {
+                size_t read = std::min(size, body.size());
+                memcpy(buffer, body.data(), read);
+                body.remove_prefix(read);
+                return read;
+            };
+        }
+        m_multipart = std::make_shared<onyx::multipart::Parser>(boundary, reader, m_multipart_settings);
+    }
+    return *m_multipart;
+}
+
+bool onyx::ONObject::getFormField(const std::string & name, std::string & value) {
+    if (isContentType("multipart/form-data")) {
+        const onyx::multipart::Part * part = getMultipart().peek(name);
+        if (part == nullptr || part->isFile())
+            return false;
+        value = part->getData().to_string();
+        return true;
+    }
+    ParamCollection & form_params = getFormParams();
+    if (!form_params.has(name))
+        return false;
+    value = form_params[name];
+    return true;
+}
+
+nlohmann::json::input_format_t onyx::ONObject::getBodyFormat() const {
+    if (isContentType("application/msgpack") || isContentType("application/x-msgpack"))
+        return nlohmann::json::input_format_t::msgpack;
+    if (isContentType("application/cbor"))
+        return nlohmann::json::input_format_t::cbor;
+    return nlohmann::json::input_format_t::json;
+}
+
+const nlohmann::json & onyx::ONObject::getJson() {
+    if (m_json)
+        return *m_json;
+    nlohmann::json::input_format_t format = getBodyFormat();
+    if (format == nlohmann::json::input_format_t::json && m_json_fast_path) {
+        m_json = std::make_shared<nlohmann::json>(getJsonDocument().toJson());
+        return *m_json;
+    }
+    try {
+        nlohmann::detail::input_adapter input(m_body.data(), m_body.size());
+        switch (format) {
+            case nlohmann::json::input_format_t::msgpack:
+                m_json = std::make_shared<nlohmann::json>(nlohmann::json::from_msgpack(std::move(input)));
+                break;
+            case nlohmann::json::input_format_t::cbor:
+                m_json = std::make_shared<nlohmann::json>(nlohmann::json::from_cbor(std::move(input)));
+                break;
+            default:
+                m_json = std::make_shared<nlohmann::json>(nlohmann::json::parse(std::move(input)));
+        }
+    } catch (const nlohmann::json::exception & ex) {
+        throw onyx::Exception(std::string("Request body isn't valid JSON: ") + ex.what(), 400);
+    }
+    return *m_json;
+}
+
+const onyx::fastjson::Document & onyx::ONObject::getJsonDocument() {
+    if (!m_json_document)
+        m_json_document = std::make_shared<onyx::fastjson::Document>(m_body);
+    return *m_json_document;
+}
+
+bool onyx::ONObject::visitJson(nlohmann::json_sax<nlohmann::json> & visitor) const {
+    return nlohmann::json::sax_parse(nlohmann::detail::input_adapter(m_body.data(), m_body.size()), &visitor, getBodyFormat());
+}
@@ -4,7 +4,15 @@
 #include "../token/Token.h"
 #include "../param/Param.h"
 #include "../cookie/Cookie.h"
+#include "../multipart/Multipart.h"
+#include "../common/json/json.hpp"
+#include "JsonVisitor.h"
+#include "../fastjson/FastJson.h"
+#include "../response/ResponseWriter.h"
+#include "../session/Session.h"
 #include <memory>
+#include <functional>
+#include <boost/utility/string_view.hpp>
 #include "../common/plog/Log.h"
 
 namespace onyx {
@@ -14,31 +22,185 @@ namespace onyx {
         TokenCollection m_token_collection;
         ParamCollection m_param_collection;
         CookieCollection m_cookies_collection;
-        std::string m_body;
+        boost::string_view m_body;
+        std::string m_content_type;
+        std::string m_accept;
+        std::shared_ptr<ParamCollection> m_form_params;
+        onyx::multipart::BodyReader m_body_reader;
+        onyx::multipart::Settings m_multipart_settings;
+        std::shared_ptr<onyx::multipart::Parser> m_multipart;
+        std::shared_ptr<nlohmann::json> m_json;
+        std::shared_ptr<onyx::fastjson::Document> m_json_document;
+        bool m_json_fast_path = false;
+        ResponseWriter * m_response_writer = nullptr;
+        std::function<std::shared_ptr<const Session>()> m_session_loader;
+        std::shared_ptr<const Session> m_session;
+        bool m_session_loaded = false;
+        bool m_csrf_enabled = false;
+        bool m_csrf_substitution = false;
+
+        /*
+            encoding of the body by Content-Type: application/msgpack, application/cbor or JSON
+        */
+        nlohmann::json::input_format_t getBodyFormat() const;
     public:
-        
-        ONObject(const TokenCollection & token, const ParamCollection & params, const CookieCollection & cookies, const std::string & body) : m_token_collection(token), m_param_collection(params), m_cookies_collection(cookies), m_body(body) {}
+
+        /*
+            body is not copied, it must outlive the object (it belongs to the onyx::Request being dispatched)
+        */
+        ONObject(const TokenCollection & token, const ParamCollection & params, const CookieCollection & cookies, boost::string_view body, const std::string & content_type = "") : m_token_collection(token), m_param_collection(params), m_cookies_collection(cookies), m_body(body), m_content_type(content_type) {}
 
         TokenCollection getTokenCollection() const {
             return m_token_collection;
         }
-        
+
         ParamCollection getParamCollection() const {
             return m_param_collection;
         }
-        
+
         CookieCollection getCookiesCollection() const {
             return m_cookies_collection;
         }
 
-        
+        /*
+            raw body as received, binary safe
+        */
         std::string getBody() const {
+            return m_body.to_string();
+        }
+
+        boost::string_view getRawBody() const {
             return m_body;
         }
 
+        std::string getContentType() const {
+            return m_content_type;
+        }
+
+        /*
+            Accept header of the request, JsonResponse picks its encoding from it
+        */
+        std::string getAccept() const {
+            return m_accept;
+        }
+
+        void setAccept(const std::string & accept) {
+            m_accept = accept;
+        }
+
+        /*
+            check media type of the body, parameters (charset, boundary) are ignored
+        */
+        bool isContentType(boost::string_view media_type) const;
+
+        /*
+            decoded fields of an application/x-www-form-urlencoded body, parsed on first call.
+            Empty for any other content type
+        */
+        ParamCollection & getFormParams();
+
+        /*
+            body of a multipart request which was not read into memory
+        */
+        void setBodyReader(onyx::multipart::BodyReader body_reader, const onyx::multipart::Settings & settings) {
+            m_body_reader = body_reader;
+            m_multipart_settings = settings;
+        }
+
+        /*
+            parts of a multipart/form-data body, read from the request as the parser advances:
+            for (auto & part : obj.getMultipart()) { ... }
+            Throws onyx::Exception for any other content type
+        */
+        onyx::multipart::Parser & getMultipart();
+
+        /*
+            value of a field of an urlencoded or multipart/form-data body, false when it is missing.
+            Multipart fields are read ahead with Parser::peek, they must come before the file uploads
+        */
+        bool getFormField(const std::string & name, std::string & value);
+
+        /*
+            body parsed as JSON on first call, later calls (handler, middleware) share the same document.
+            MessagePack and CBOR bodies (Content-Type application/msgpack, application/cbor) are decoded
+            to the same document. Routes added with json_fast_path build JSON bodies from getJsonDocument().
+            Throws onyx::Exception with code 400 when the body isn't valid JSON
+        */
+        const nlohmann::json & getJson();
+
+        /*
+            body indexed by the vectorized parser on first call, for reading selected fields
+            (atPointer, operator[]) of a large document without building a DOM
+        */
+        const onyx::fastjson::Document & getJsonDocument();
+
+        void setJsonFastPath(bool json_fast_path) {
+            m_json_fast_path = json_fast_path;
+        }
+
+        /*
+            stream the body (JSON, MessagePack or CBOR) through a SAX handler without building the document,
+            returns false when the body is invalid or the handler stopped parsing
+        */
+        bool visitJson(nlohmann::json_sax<nlohmann::json> & visitor) const;
+
+        /*
+            output of the request for responses written while the handler runs, nullptr outside of a FastCGI request
+        */
+        ResponseWriter * getResponseWriter() const {
+            return m_response_writer;
+        }
+
+        void setResponseWriter(ResponseWriter * response_writer) {
+            m_response_writer = response_writer;
+        }
+
+        /*
+            session of the request, loaded from the storage on first call only, so requests that
+            never ask for it don't reach the storage. nullptr for anonymous requests
+        */
+        std::shared_ptr<const Session> getSession() {
+            if (!m_session_loaded) {
+                m_session_loaded = true;
+                if (m_session_loader)
+                    m_session = m_session_loader();
+            }
+            return m_session;
+        }
+
+        void setSessionLoader(std::function<std::shared_ptr<const Session>()> session_loader) {
+            m_session_loader = std::move(session_loader);
+        }
+
+        void setCSRFEnabled(bool csrf_enabled) {
+            m_csrf_enabled = csrf_enabled;
+        }
+
+        /*
+            CSRF token of the session, empty when the protection is off or there is no session.
+            Templates rendered with HtmlResponse(obj, ...) get it as {{csrf_token_value}}
+        */
+        std::string getCSRFToken() {
+            if (!m_csrf_enabled)
+                return "";
+            std::shared_ptr<const Session> session = getSession();
+            return session ? session->getToken() : "";
+        }
+
+        /*
+            replace %%csrf_token_value%% markers in the response of the handler,
+            other responses aren't scanned
+        */
+        void requestCSRFSubstitution() {
+            m_csrf_substitution = true;
+        }
+
+        bool isCSRFSubstitutionRequested() const {
+            return m_csrf_substitution;
+        }
+
     };
 }
 
 
 #endif
-
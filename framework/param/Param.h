@@ -8,24 +8,38 @@
 #include <string>
 #include <string.h>
 #include <memory>
+#include <boost/utility/string_view.hpp>
 #include "../exception/Exception.h"
 #include "../common/plog/Log.h"
 
 namespace onyx {
     
+    /*
+     * Parse the query string or urlencoded form body. Repeated keys (tag=a&tag=b) are kept,
+     * operator[] returns the first value, getAll returns every value in order of appearance
+    */
+    
     class ParamCollection {
     private:
-        std::map<std::string, std::string> m_params;
+        std::multimap<std::string, std::string> m_params;
     public:
-        ParamCollection(const std::string & params);
+        ParamCollection(boost::string_view params);
         
         std::string & operator[](const std::string & key) {
-            auto it = m_params.find(key);
-            if(it == m_params.end())
+            auto it = m_params.lower_bound(key);
+            if(it == m_params.end() || it->first != key)
                 throw onyx::Exception("Key doesn't exists in the ParamCollection");
             return it->second;
         }
         
+        std::vector<std::string> getAll(const std::string & key) const {
+            std::vector<std::string> values;
+            auto range = m_params.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it)
+                values.push_back(it->second);
+            return values;
+        }
+        
         bool has(const std::string & key){
             auto it = m_params.find(key);
             if(it == m_params.end())
@@ -44,4 +58,3 @@ namespace onyx {
 
 
 #endif
-
@@ -0,0 +1,78 @@
+#ifndef QUERYTOKENIZER_H
+#define QUERYTOKENIZER_H
+
+#include <string>
+#include <boost/utility/string_view.hpp>
+#include "../common/scan.h"
+
+namespace onyx {
+
+    namespace param {
+
+        /*
+         * One key=value pair of a query string or urlencoded form body.
+         * key and value point into the tokenized input, *_encoded is set when the part contains '%' or '+'
+         */
+        struct QueryPair {
+            boost::string_view key;
+            boost::string_view value;
+            bool key_encoded;
+            bool value_encoded;
+        };
+
+        /*
+         * Split "k1=v1&k2=v2&k1=v3" in one pass and call callback(const QueryPair &) for every pair,
+         * repeated keys included. Empty segments are skipped, a segment without '=' gets an empty value.
+         * The scan for '&', '=', '%' and '+' is vectorized (see common/scan.h)
+         */
+        template<typename Callback>
+        void tokenize_query(boost::string_view input, Callback && callback) {
+            const char * data = input.data();
+            size_t pair_start = 0;
+            size_t eq = std::string::npos;
+            bool key_encoded = false;
+            bool value_encoded = false;
+
+            auto emit = [&](size_t pair_end) {
+                if (pair_end > pair_start) {
+                    QueryPair pair;
+                    if (eq == std::string::npos) {
+                        pair.key = boost::string_view(data + pair_start, pair_end - pair_start);
+                        pair.value = boost::string_view();
+                    } else {
+                        pair.key = boost::string_view(data + pair_start, eq - pair_start);
+                        pair.value = boost::string_view(data + eq + 1, pair_end - eq - 1);
+                    }
+                    pair.key_encoded = key_encoded;
+                    pair.value_encoded = value_encoded;
+                    callback(pair);
+                }
+                pair_start = pair_end + 1;
+                eq = std::string::npos;
+                key_encoded = false;
+                value_encoded = false;
+            };
+
+            onyx::utils::scan_any_of(data, input.size(), '&', '=', '%', '+', [&](size_t pos) {
+                switch (data[pos]) {
+                    case '&':
+                        emit(pos);
+                        break;
+                    case '=':
+                        if (eq == std::string::npos)
+                            eq = pos;
+                        break;
+                    default:
+                        if (eq == std::string::npos)
+                            key_encoded = true;
+                        else
+                            value_encoded = true;
+                }
+                return true;
+            });
+            emit(input.size());
+        }
+    }
+}
+
+#endif
@@ -1,7 +1,6 @@
 #ifndef REQUEST_H
 #define REQUEST_H
 
-#include <curl/curl.h>
 #include <string>
 #include <string.h>
 #include <vector>
@@ -10,6 +9,9 @@
 #include <algorithm>
 
 #include "../common/utils.h"
+#include "../param/QueryTokenizer.h"
+#include "../multipart/Multipart.h"
+#include "../response/ResponseWriter.h"
 
 namespace onyx {
 
@@ -24,6 +26,10 @@ namespace onyx {
         std::string m_params;
         std::string m_cookies;
         std::string m_content_type;
+        std::string m_accept;
+        std::string m_csrf_token;
+        onyx::multipart::BodyReader m_body_reader;
+        onyx::ResponseWriter * m_response_writer = nullptr;
 
         static inline void ltrim(std::string &s) {
             s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](int ch) {
@@ -57,31 +63,52 @@ namespace onyx {
             m_ip = ip;
         }
 
-        void setBody(const char* body) {
-            char * data = (char *) malloc(strlen(body) + 1);
-            memset(data, 0, strlen(body) + 1);
-            memcpy(data, body, strlen(body));
-            onyx::utils::urldecode(data);
-            m_body = data;
-            free(data);
+        /*
+         * Raw request body, may contain NUL bytes. Nothing is decoded here,
+         * see onyx::ONObject::getFormParams
+         */
+        void setBody(const char* body, size_t size) {
+            m_body.assign(body, size);
+        }
+
+        /*
+         * Source of a body that is read incrementally (multipart/form-data) instead of through setBody
+         */
+        void setBodyReader(onyx::multipart::BodyReader body_reader) {
+            m_body_reader = body_reader;
+        }
+
+        void setResponseWriter(onyx::ResponseWriter * response_writer) {
+            m_response_writer = response_writer;
         }
 
         void setUrl(const char* url) {
-            char * url_decode = curl_unescape(url, strlen(url));
-            m_url = url_decode;
-            curl_free(url_decode);
+            m_url = url;
+            m_url.resize(onyx::utils::urldecode(&m_url[0], m_url.size(), false));
         }
 
+        /*
+         * Raw query string, keys and values are decoded by onyx::ParamCollection
+         */
         void setParams(const char* params) {
-            char * params_decode = curl_unescape(params, strlen(params));
-            m_params = params_decode;
-            curl_free(params_decode);
+            m_params = params;
         }
 
         void setContentType(const std::string content_type) {
             m_content_type = content_type;
         }
 
+        void setAccept(const std::string & accept) {
+            m_accept = accept;
+        }
+
+        /*
+         * X-CSRF-Token header, checked before the csrf_token field of the body
+         */
+        void setCSRFToken(const std::string & csrf_token) {
+            m_csrf_token = csrf_token;
+        }
+
         std::string getUrl() const {
             return m_url;
         }
@@ -94,10 +121,18 @@ namespace onyx {
             return m_params;
         }
 
-        std::string getBody() const {
+        const std::string & getBody() const {
             return m_body;
         }
 
+        onyx::multipart::BodyReader getBodyReader() const {
+            return m_body_reader;
+        }
+
+        onyx::ResponseWriter * getResponseWriter() const {
+            return m_response_writer;
+        }
+
         std::string getCookies() const {
             return m_cookies;
         }
@@ -106,26 +141,24 @@ namespace onyx {
             return m_content_type;
         }
 
+        std::string getAccept() const {
+            return m_accept;
+        }
+
+        std::string getCSRFToken() const {
+            return m_csrf_token;
+        }
+
+        /*
+         * Parse and decode urlencoded form body. The first value of a repeated key wins,
+         * use onyx::ParamCollection to get all of them
+         */
         static std::map<std::string, std::string> parse_form_params(const std::string& body) {
             std::map<std::string, std::string> map_form_params;
-            std::unique_ptr<char[] > buffer(new char[body.size() + 1]);
-            memset(buffer.get(), '\0', body.size() + 1);
-            strncpy(buffer.get(), body.c_str(), body.size() + 1);
-            char *savep_tr;
-            char *token = strtok_r(buffer.get(), "&", &savep_tr);
-            std::vector<std::string> tmp;
-            while (token != NULL) {
-                tmp.push_back(token);
-                token = strtok_r(NULL, "&", &savep_tr);
-            }
-            for (size_t i = 0; i < tmp.size(); i++) {
-                std::string value = tmp[i];
-                size_t sep = value.find("=");
-                std::string key, val;
-                key = value.substr(0, sep);
-                val = value.substr(sep + 1, value.size() - sep - 1);
-                map_form_params.insert(std::pair<std::string, std::string>(key, val));
-            }
+            onyx::param::tokenize_query(body, [&map_form_params](const onyx::param::QueryPair & pair) {
+                map_form_params.emplace(pair.key_encoded ? onyx::utils::urldecode(pair.key) : pair.key.to_string(),
+                        pair.value_encoded ? onyx::utils::urldecode(pair.value) : pair.value.to_string());
+            });
             return map_form_params;
         }
 
@@ -1,6 +1,11 @@
 #ifndef BASERESPONSE_H
 #define BASERESPONSE_H
 
+#include <string>
+#include <cstdlib>
+#include "ResponseWriter.h"
+#include "../exception/Exception.h"
+
 namespace onyx {
 
     class BaseResponse {
@@ -16,13 +21,64 @@ namespace onyx {
             return m_header + m_body;
         }
         
+        /*
+            throws onyx::Exception once the response is sent, the headers are gone then
+        */
         void addHeader(const std::string & header){
+            if (m_header.size() < 4)
+                throw onyx::Exception("Header " + header + " added to a response already sent");
             std::string str = "\r\n" + header;
             m_header.insert(m_header.size() - 4, str);
         }
 
+        /*
+            write the response to the output instead of returning it from the handler,
+            the object converts to an empty string afterwards
+        */
+        void send(ResponseWriter & writer){
+            writer.setStatus(parseStatus(m_header));
+            writer.write(m_header);
+            writer.write(m_body);
+            m_header.clear();
+            m_body.clear();
+        }
+
+        /*
+            status from the Status header of a response, 200 without one
+        */
+        static unsigned parseStatus(const std::string & response){
+            size_t end = response.find("\r\n\r\n");
+            if (end == std::string::npos)
+                end = response.size();
+            for (size_t line = 0; line < end;) {
+                if (response.compare(line, 7, "Status:") == 0)
+                    return static_cast<unsigned> (strtoul(response.c_str() + line + 7, nullptr, 10));
+                line = response.find("\r\n", line);
+                if (line == std::string::npos)
+                    break;
+                line += 2;
+            }
+            return 200;
+        }
+
+    protected:
+
+        /*
+            send the headers, then the body produced by write(). When write throws, the output is
+            discarded if none of it reached the transport yet, a longer response is left truncated
+        */
+        template<typename Write>
+        void stream(ResponseWriter & writer, Write write){
+            send(writer);
+            try {
+                write();
+            } catch (...) {
+                writer.discard();
+                throw;
+            }
+        }
+
     };
 }
 
 #endif
-
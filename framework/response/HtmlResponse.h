@@ -5,7 +5,10 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include "../common/mustache/mustache.h"
+#include "../template/TemplateRegistry.h"
+#include "../object/ONObject.h"
 
 namespace onyx {
     
@@ -25,6 +28,32 @@ namespace onyx {
             }
             return buffer.str();
         }
+
+        template<typename Data>
+        void renderTemplate(ResponseWriter * writer, const std::string & template_name, const Data & data, const TemplateRegistry::CSRFTokenProvider & csrf_token = nullptr) {
+            if (writer == nullptr) {
+                TemplateRegistry::getInstance()->render(template_name, data, [this](boost::string_view chunk) {
+                    m_body.append(chunk.data(), chunk.size());
+                }, csrf_token);
+                return;
+            }
+            // headers go out with the first chunk, a missing or invalid template still throws before any output
+            try {
+                TemplateRegistry::getInstance()->render(template_name, data, [this, writer](boost::string_view chunk) {
+                    if (!m_header.empty())
+                        send(*writer);
+                    writer->write(chunk);
+                }, csrf_token);
+            } catch (...) {
+                // the page is dropped if none of it reached the transport yet
+                if (m_header.empty())
+                    writer->discard();
+                throw;
+            }
+            if (!m_header.empty())
+                send(*writer);
+        }
+
     public:
 
         explicit HtmlResponse(const std::string & path_to_html_file) :
@@ -32,6 +61,45 @@ namespace onyx {
             m_body = file_reader(path_to_html_file);
         }
 
+        /*
+            render a Mustache template of onyx::TemplateRegistry, the file is read and parsed once
+        */
+        HtmlResponse(const std::string & template_name, const kainjow::mustache::data & data) :
+        BaseResponse("Content-type: text/html; charset=utf-8\r\n\r\n") {
+            renderTemplate(nullptr, template_name, data);
+        }
+
+        /*
+            render straight from JSON with the compiled template, names resolve against the json document.
+            A template, so a braced list (HtmlResponse("page.html", {})) still means kainjow data
+        */
+        template<typename Json, typename std::enable_if<std::is_same<Json, nlohmann::json>::value, int>::type = 0>
+        HtmlResponse(const std::string & template_name, const Json & data) :
+        BaseResponse("Content-type: text/html; charset=utf-8\r\n\r\n") {
+            renderTemplate(nullptr, template_name, data);
+        }
+
+        /*
+            render straight to the output of the request, chunks are written as the template produces them.
+            {{csrf_token_value}} is the CSRF token of the session.
+            An error in the middle of the template throws: nothing is sent while the page is still
+            buffered in the writer, a longer page is truncated
+        */
+        HtmlResponse(onyx::ONObject & obj, const std::string & template_name, const kainjow::mustache::data & data) :
+        BaseResponse("Content-type: text/html; charset=utf-8\r\n\r\n") {
+            renderTemplate(obj.getResponseWriter(), template_name, data, [&obj]() {
+                return obj.getCSRFToken();
+            });
+        }
+
+        template<typename Json, typename std::enable_if<std::is_same<Json, nlohmann::json>::value, int>::type = 0>
+        HtmlResponse(onyx::ONObject & obj, const std::string & template_name, const Json & data) :
+        BaseResponse("Content-type: text/html; charset=utf-8\r\n\r\n") {
+            renderTemplate(obj.getResponseWriter(), template_name, data, [&obj]() {
+                return obj.getCSRFToken();
+            });
+        }
+
     };
 }
 
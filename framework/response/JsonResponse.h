@@ -1,15 +1,150 @@
 #ifndef JSONRESPONSE_H
 #define JSONRESPONSE_H
 
+#include <functional>
+#include <memory>
+#include <utility>
+#include <boost/utility/string_view.hpp>
 #include "BaseResponse.h"
+#include "ResponseWriter.h"
+#include "../object/ONObject.h"
 #include "../common/json/json.hpp"
+#include "../arena/Arena.h"
 
 using json = nlohmann::json;
 
 
 namespace onyx {
 
+    /*
+     * nlohmann output adapter writing to a ResponseWriter
+     */
+    class JsonOutputAdapter : public nlohmann::detail::output_adapter_protocol<char> {
+    private:
+        ResponseWriter & m_writer;
+    public:
+
+        explicit JsonOutputAdapter(ResponseWriter & writer) : m_writer(writer) {
+        }
+
+        virtual void write_character(char c) override {
+            m_writer.put(c);
+        }
+
+        virtual void write_characters(const char * s, std::size_t length) override {
+            m_writer.write(s, length);
+        }
+    };
+
+    /*
+     * encodings of a JsonResponse bound to a request, chosen from its Accept header
+     */
+    enum class JsonEncoding {
+        JSON, MSGPACK, CBOR
+    };
+
+    /*
+     * Produces the elements of a streamed array: fill element and return true, return false when there are no more
+     */
+    typedef std::function<bool(json & element)> JsonGenerator;
+
     class JsonResponse : public BaseResponse {
+    private:
+
+        template<typename BasicJsonType>
+        static void serialize(nlohmann::detail::output_adapter_t<char> output, const BasicJsonType & body, JsonEncoding encoding) {
+            switch (encoding) {
+                case JsonEncoding::MSGPACK:
+                    nlohmann::detail::binary_writer<BasicJsonType, char>(output).write_msgpack(body);
+                    break;
+                case JsonEncoding::CBOR:
+                    nlohmann::detail::binary_writer<BasicJsonType, char>(output).write_cbor(body);
+                    break;
+                default:
+                    nlohmann::detail::serializer<BasicJsonType>(output, ' ').dump(body, false, false, 0);
+            }
+        }
+
+        static std::string contentTypeHeader(JsonEncoding encoding) {
+            switch (encoding) {
+                case JsonEncoding::MSGPACK:
+                    return "Content-type: application/msgpack\r\n\r\n";
+                case JsonEncoding::CBOR:
+                    return "Content-type: application/cbor\r\n\r\n";
+                default:
+                    return "Content-type: application/json; charset=utf-8\r\n\r\n";
+            }
+        }
+
+        template<typename BasicJsonType>
+        void writeNegotiated(onyx::ONObject & obj, const BasicJsonType & body) {
+            JsonEncoding encoding = negotiate(obj.getAccept());
+            m_header = contentTypeHeader(encoding);
+            addHeader("Vary: Accept");
+            ResponseWriter * writer = obj.getResponseWriter();
+            if (writer == nullptr) {
+                serialize(std::make_shared<nlohmann::detail::output_string_adapter<char>>(m_body), body, encoding);
+                return;
+            }
+            stream(*writer, [writer, &body, encoding]() {
+                serialize(std::make_shared<JsonOutputAdapter>(*writer), body, encoding);
+            });
+        }
+
+        /*
+            media types are case-insensitive, ASCII only so the locale doesn't matter
+        */
+        static bool equalsIgnoreCase(boost::string_view value, boost::string_view expected) {
+            if (value.size() != expected.size())
+                return false;
+            for (size_t i = 0; i < value.size(); i++) {
+                char ch = value[i];
+                if (ch >= 'A' && ch <= 'Z')
+                    ch += 'a' - 'A';
+                if (ch != expected[i])
+                    return false;
+            }
+            return true;
+        }
+
+        /*
+            qvalue of a media range ("0.5"), 0 when malformed. Parsed by hand, atof reads the
+            decimal point of the locale
+        */
+        static double parseQuality(boost::string_view value) {
+            while (!value.empty() && value.back() == ' ')
+                value.remove_suffix(1);
+            double q = 0;
+            size_t i = 0;
+            for (; i < value.size() && value[i] >= '0' && value[i] <= '9'; i++)
+                q = q * 10 + (value[i] - '0');
+            if (i == 0)
+                return 0;
+            if (i < value.size() && value[i] == '.') {
+                double scale = 0.1;
+                for (i++; i < value.size() && value[i] >= '0' && value[i] <= '9'; i++, scale /= 10)
+                    q += (value[i] - '0') * scale;
+            }
+            if (i != value.size())
+                return 0;
+            return q > 1 ? 1 : q;
+        }
+
+        void writeArray(ResponseWriter & writer, JsonGenerator generator) {
+            nlohmann::detail::serializer<json> serializer(std::make_shared<JsonOutputAdapter>(writer), ' ');
+            json element;
+            bool first = true;
+            writer.put('[');
+            while (generator(element)) {
+                if (!first)
+                    writer.put(',');
+                serializer.dump(element, false, false, 0);
+                element = nullptr;
+                first = false;
+            }
+            writer.put(']');
+        }
+
     public:
 
         explicit JsonResponse(const std::string & body) :
@@ -21,9 +156,102 @@ namespace onyx {
         BaseResponse("Content-type: application/json; charset=utf-8\r\n\r\n") {
             m_body = body.dump();
         }
+
+        /*
+            other basic_json specializations, e.g. onyx::arena::json
+        */
+        template<typename BasicJsonType, typename std::enable_if<nlohmann::detail::is_basic_json<BasicJsonType>::value && !std::is_same<BasicJsonType, json>::value, int>::type = 0>
+        explicit JsonResponse(const BasicJsonType & body) :
+        BaseResponse("Content-type: application/json; charset=utf-8\r\n\r\n") {
+            m_body = body.dump();
+        }
+
+        /*
+            serialize body straight to the output of the request, no intermediate string is built.
+            The body is encoded as MessagePack or CBOR when the Accept header of the request prefers them.
+            The response is sent by the constructor, headers can't be added afterwards. A serialization
+            error (invalid UTF-8) throws: nothing is sent when the output is still buffered, a body longer
+            than the buffer of the writer is truncated
+        */
+        JsonResponse(onyx::ONObject & obj, const json & body) :
+        BaseResponse("Content-type: application/json; charset=utf-8\r\n\r\n") {
+            writeNegotiated(obj, body);
+        }
+
+        template<typename BasicJsonType, typename std::enable_if<nlohmann::detail::is_basic_json<BasicJsonType>::value && !std::is_same<BasicJsonType, json>::value, int>::type = 0>
+        JsonResponse(onyx::ONObject & obj, const BasicJsonType & body) :
+        BaseResponse("Content-type: application/json; charset=utf-8\r\n\r\n") {
+            writeNegotiated(obj, body);
+        }
+
+        /*
+            stream a JSON array to the output of the request, each element is written
+            as soon as the generator (any callable bool(json & element)) produces it.
+            Always JSON, the length of the array isn't known upfront. An exception of the generator
+            is handled like a serialization error above
+        */
+        template<typename Generator, typename = decltype(bool(std::declval<Generator &>()(std::declval<json &>())))>
+        JsonResponse(onyx::ONObject & obj, Generator generator) :
+        BaseResponse("Content-type: application/json; charset=utf-8\r\n\r\n") {
+            ResponseWriter * writer = obj.getResponseWriter();
+            if (writer == nullptr) {
+                StringResponseWriter buffer;
+                writeArray(buffer, generator);
+                m_body = buffer.getOutput();
+                return;
+            }
+            stream(*writer, [this, writer, &generator]() {
+                writeArray(*writer, generator);
+            });
+        }
+
+        /*
+            encoding preferred by an Accept header: the media range with the highest q wins,
+            the first listed on a tie. JSON for an empty header, wildcards and when nothing matches
+        */
+        static JsonEncoding negotiate(boost::string_view accept) {
+            JsonEncoding best = JsonEncoding::JSON;
+            double best_q = 0;
+            while (!accept.empty()) {
+                size_t end = accept.find(',');
+                boost::string_view range = accept.substr(0, end);
+                accept.remove_prefix(end == boost::string_view::npos ? accept.size() : end + 1);
+
+                double q = 1;
+                size_t params = range.find(';');
+                boost::string_view type = range.substr(0, params);
+                while (params != boost::string_view::npos) {
+                    range.remove_prefix(params + 1);
+                    params = range.find(';');
+                    boost::string_view param = range.substr(0, params);
+                    while (!param.empty() && param.front() == ' ')
+                        param.remove_prefix(1);
+                    if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=')
+                        q = parseQuality(param.substr(2));
+                }
+                while (!type.empty() && type.front() == ' ')
+                    type.remove_prefix(1);
+                while (!type.empty() && type.back() == ' ')
+                    type.remove_suffix(1);
+
+                JsonEncoding encoding;
+                if (equalsIgnoreCase(type, "application/msgpack") || equalsIgnoreCase(type, "application/x-msgpack"))
+                    encoding = JsonEncoding::MSGPACK;
+                else if (equalsIgnoreCase(type, "application/cbor"))
+                    encoding = JsonEncoding::CBOR;
+                else if (equalsIgnoreCase(type, "application/json") || equalsIgnoreCase(type, "application/*") || type == "*/*")
+                    encoding = JsonEncoding::JSON;
+                else
+                    continue;
+                if (q > best_q) {
+                    best = encoding;
+                    best_q = q;
+                }
+            }
+            return best;
+        }
          
     };
 }
 
 #endif
-
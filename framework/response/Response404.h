@@ -13,7 +13,7 @@ namespace onyx {
     public:
 
         explicit Response404() :
-        BaseResponse("Content-type: text/html; charset=utf-8\r\n\r\n") {
+        BaseResponse("Status: 404 Not Found\r\nContent-type: text/html; charset=utf-8\r\n\r\n") {
             m_body = "<html><head><title>404</title></head><body bgcolor=\"white\"><center><h1>PAGE NOT FOUND 404</h1></center><hr><center><img src=\"data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAgAAAAIACAYAAAD0eNT6AAAACXBIWXMAAA9hAAAPYQGoP6dpAAAKT2lDQ1BQaG90b3Nob3AgSUNDIHByb2ZpbGUAAHjanVNnVFPpFj333vRCS4iAlEtvUhUIIFJCi4AUkSYqIQkQSoghodkVUcERRUUEG8igiAOOjoCMFVEsDIoK2AfkIaKOg6OIisr74Xuja9a89+bN/rXXPues852zzwfACAyWSDNRNYAMqUIeEeCDx8TG4eQuQIEKJHAAEAizZCFz/SMBAPh+PDwrIsAHvgABeNMLCADATZvAMByH/w/qQplcAYCEAcB0kThLCIAUAEB6jkKmAEBGAYCdmCZTAKAEAGDLY2LjAFAtAGAnf+bTAICd+Jl7AQBblCEVAaCRACATZYhEAGg7AKzPVopFAFgwABRmS8Q5ANgtADBJV2ZIALC3AMDOEAuyAAgMADBRiIUpAAR7AGDIIyN4AISZABRG8lc88SuuEOcqAAB4mbI8uSQ5RYFbCC1xB1dXLh4ozkkXKxQ2YQJhmkAuwnmZGTKBNA/g88wAAKCRFRHgg/P9eM4Ors7ONo62Dl8t6r8G/yJiYuP+5c+rcEAAAOF0ftH+LC+zGoA7BoBt/qIl7gRoXgugdfeLZrIPQLUAoOnaV/Nw+H48PEWhkLnZ2eXk5NhKxEJbYcpXff5nwl/AV/1s+X48/Pf14L7iJIEyXYFHBPjgwsz0TKUcz5IJhGLc5o9H/LcL//wd0yLESWK5WCoU41EScY5EmozzMqUiiUKSKcUl0v9k4t8s+wM+3zUAsGo+AXuRLahdYwP2SycQWHTA4vcAAPK7b8HUKAgDgGiD4c93/+8//UegJQCAZkmScQAAXkQkLlTKsz/HCAAARKCBKrBBG/TBGCzABhzBBdzBC/xgNoRCJMTCQhBCCmSAHHJgKayCQiiGzbAdKmAv1EAdNMBRaIaTcA4uwlW4Dj1wD/phCJ7BKLyBCQRByAgTYSHaiAFiilgjjggXmYX4IcFIBBKLJCDJiBRRIkuRNUgxUopUIFVIHfI9cgI5h1xGupE7yAAygvyGvEcxlIGyUT3UDLVDuag3GoRGogvQZHQxmo8WoJvQcrQaPYw2oefQq2gP2o8+Q8cwwOgYBzPEbDAuxsNCsTgsCZNjy7EirAyrxhqwVqwDu4n1Y8+xdwQSgUXACTYEd0IgYR5BSFhMWE7YSKggHCQ0EdoJNwkDhFHCJyKTqEu0JroR+cQYYjIxh1hILCPWEo8TLxB7iEPENyQSiUMyJ7mQAkmxpFTSEtJG0m5SI+ksqZs0SBojk8naZGuyBzmULCAryIXkneTD5DPkG+Qh8lsKnWJAcaT4U+IoUspqShnlEOU05QZlmDJBVaOaUt2ooVQRNY9aQq2htlKvUYeoEzR1mjnNgxZJS6WtopXTGmgXaPdpr+h0uhHdlR5Ol9BX0svpR+iX6AP0dwwNhhWDx4hnKBmbGAcYZxl3GK+YTKYZ04sZx1QwNzHrmOeZD5lvVVgqtip8FZHKCpVKlSaVGyovVKmqpqreqgtV81XLVI+pXlN9rkZVM1PjqQnUlqtVqp1Q61MbU2epO6iHqmeob1Q/pH5Z/YkGWcNMw09DpFGgsV/jvMYgC2MZs3gsIWsNq4Z1gTXEJrHN2Xx2KruY/R27iz2qqaE5QzNKM1ezUvOUZj8H45hx+Jx0TgnnKKeX836K3hTvKeIpG6Y0TLkxZVxrqpaXllirSKtRq0frvTau7aedpr1Fu1n7gQ5Bx0onXCdHZ4/OBZ3nU9lT3acKpxZNPTr1ri6qa6UbobtEd79up+6Ynr5egJ5Mb6feeb3n+hx9L/1U/W36p/VHDFgGswwkBtsMzhg8xTVxbzwdL8fb8VFDXcNAQ6VhlWGX4YSRudE8o9VGjUYPjGnGXOMk423GbcajJgYmISZLTepN7ppSTbmmKaY7TDtMx83MzaLN1pk1mz0x1zLnm+eb15vft2BaeFostqi2uGVJsuRaplnutrxuhVo5WaVYVVpds0atna0l1rutu6cRp7lOk06rntZnw7Dxtsm2qbcZsOXYBtuutm22fWFnYhdnt8Wuw+6TvZN9un2N/T0HDYfZDqsdWh1+c7RyFDpWOt6azpzuP33F9JbpL2dYzxDP2DPjthPLKcRpnVOb00dnF2e5c4PziIuJS4LLLpc+Lpsbxt3IveRKdPVxXeF60vWdm7Obwu2o26/uNu5p7ofcn8w0nymeWTNz0MPIQ+BR5dE/C5+VMGvfrH5PQ0+BZ7XnIy9jL5FXrdewt6V3qvdh7xc+9j5yn+M+4zw33jLeWV/MN8C3yLfLT8Nvnl+F30N/I/9k/3r/0QCngCUBZwOJgUGBWwL7+Hp8Ib+OPzrbZfay2e1BjKC5QRVBj4KtguXBrSFoyOyQrSH355jOkc5pDoVQfujW0Adh5mGLw34MJ4WHhVeGP45wiFga0TGXNXfR3ENz30T6RJZE3ptnMU85ry1KNSo+qi5qPNo3ujS6P8YuZlnM1VidWElsSxw5LiquNm5svt/87fOH4p3iC+N7F5gvyF1weaHOwvSFpxapLhIsOpZATIhOOJTwQRAqqBaMJfITdyWOCnnCHcJnIi/RNtGI2ENcKh5O8kgqTXqS7JG8NXkkxTOlLOW5hCepkLxMDUzdmzqeFpp2IG0yPTq9MYOSkZBxQqohTZO2Z+pn5mZ2y6xlhbL+xW6Lty8elQfJa7OQrAVZLQq2QqboVFoo1yoHsmdlV2a/zYnKOZarnivN7cyzytuQN5zvn//tEsIS4ZK2pYZLVy0dWOa9rGo5sjxxedsK4xUFK4ZWBqw8uIq2Km3VT6vtV5eufr0mek1rgV7ByoLBtQFr6wtVCuWFfevc1+1dT1gvWd+1YfqGnRs+FYmKrhTbF5cVf9go3HjlG4dvyr+Z3JS0qavEuWTPZtJm6ebeLZ5bDpaql+aXDm4N2dq0Dd9WtO319kXbL5fNKNu7g7ZDuaO/PLi8ZafJzs07P1SkVPRU+lQ27tLdtWHX+G7R7ht7vPY07NXbW7z3/T7JvttVAVVN1WbVZftJ+7P3P66Jqun4lvttXa1ObXHtxwPSA/0HIw6217nU1R3SPVRSj9Yr60cOxx++/p3vdy0NNg1VjZzG4iNwRHnk6fcJ3/ceDTradox7rOEH0x92HWcdL2pCmvKaRptTmvtbYlu6T8w+0dbq3nr8R9sfD5w0PFl5SvNUyWna6YLTk2fyz4ydlZ19fi753GDborZ752PO32oPb++6EHTh0kX/i+c7vDvOXPK4dPKy2+UTV7hXmq86X23qdOo8/pPTT8e7nLuarrlca7nuer21e2b36RueN87d9L158Rb/1tWeOT3dvfN6b/fF9/XfFt1+cif9zsu72Xcn7q28T7xf9EDtQdlD3YfVP1v+3Njv3H9qwHeg89HcR/cGhYPP/pH1jw9DBY+Zj8uGDYbrnjg+OTniP3L96fynQ89kzyaeF/6i/suuFxYvfvjV69fO0ZjRoZfyl5O/bXyl/erA6xmv28bCxh6+yXgzMV70VvvtwXfcdx3vo98PT+R8IH8o/2j5sfVT0Kf7kxmTk/8EA5jz/GMzLdsAAAAgY0hSTQAAeiUAAICDAAD5/wAAgOkAAHUwAADqYAAAOpgAABdvkl/FRgAAkcpJREFUeNrsnXd8FMX7xz+zuXR679IERaSJIooFRBHlZ2/Y61fF3htW7L1ir6ioWLEACqIiIkiRJtJ7CTUhPbnb+f2xSbxcdmdn93b3bvee9+t1rySXy2VvduZ5PvPMM88wzjkIgiAIgkgtFGoCgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEARBAoAgCIIgCBIABEEQBEGQACAIgiAIggQAQRAEQRAkAAiCIAiCIAFAEARBEAQJAIIgCIIgSAAQBEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBECQACIIgCIIgAUAQBEEQJAAIgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEARBAoAgCIIgCBIABEEQBEGQACAIgiAIggQAQRAEQRAkAAiCIAiCIAFAEARBEAQJAIIgCIIgSAAQBEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBECQACIIgCIIEAEEQBEEQJAAIgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEARBAoAgCIIgCBIABEEQBEGQACAIgiAIggQAQRAEQRAkAAiCIAiCIAFAEARBEAQJAIIgCIIgSAAQBEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBkAAgCIIgCIIEAEEQBEEQJAAIgiAIgiABQBAEQRCEzwkl2wUxxlKl7b3+oJy6O0EQZJ8SB+fJ9TFD1M8DM4DivR4SCARB9onsE0UAiAAMqHivnwYcQZB9IvtEAoBwYVAxh9+fx/l7GnAEQbZJ9u+dtE3x2ieyTSQAknpgsTiec3NAcBvvT4ONIMg+eTGZ4Dben+wTCYCkGFhM8DNzaSBzk8HrRJSABhtBBNc2OT3717MVMvaJ27Q1NFEhAZCwwcUsOnwWxyDUG2Aipc0N/gd3QAzQYCOI1LFNdu2TyDbp/U+yTSQAkn5wMRuDhlkYfFavlxs8F/t7buF/cRpsBJFStskpx2/k0PVm92SbSAD4ZoAxk8Gj9ztmc9BZRW8gcZ0BITPguIVBRIONIJLT8du1TTITFruRAC6wH27YJrJLJAA8cfxGA4tJOn6rgoBLDApuEiGIHXiMhABBBM7xMxP746VtYpK2yUwMyNomskskAGwPsngHFzN4zkxA2J31w8C56w2sWJXMdQaW2eCmAUcQiXX8Zo6aWXg+GWwTj7oWrmOf4hECZJMAsGQrTZigUsDM4gAzcvzMoeesKG1RSE1PPYue44LBCcmogl2xQBCENecv4/hlJiRM8Hq3bRN36DnAOJcgaWxS0vnbFBcA8c76ZRy62c/xigBuw/lzC4PLTAhwiwOKhABBOOP4zewSLNodGWEgGwmI1/nbsVV27ZJnNonOAvDPQGNxDjBm8BC9VmZwyw40qwMqNrRmtkRA4TeCSM4JiaxdimfCYiUCYBZZFNkmI7vEY67RzC6RTSIBELfzN3LYsT8rEiJAkRxkRoNNRvWaDTLVwoCzKgQoGYcgnJ/1uzEhUWwKACdtk8gWVb9ONbFLejaIkQggASA72GQGmazj1/tekRAKZtdhprStqGrm8ICjaABBuDvrN0viszMhcSJaKRMBMLJNaoy9UKOej36NYmKXGOQSmDnZo9QUAG44/9hHrLM3+73eINUb7DLIOH2zhxrHgIOBECARQBD2nb+TExLFhhAQRQOs2CXEOHQedU1qjBjgBhOPartklASoF4mwEg1IKXsUosEmHGhmA0AxcPAiMSA7ECERBbATXotV19xg8EFCCKgwX4eTiQbQkgBBjl9+1h9rExSLjl/mOb33ddI2KTBfzzeyS3qTFqPJCYf1JYGUEQEhGnCme2GNZv1Gg0jvd4qkOIgn1CZS2KrOwGOCwSESAjxGuXPB4KdoAEF4M+u3Yp+MJitG72E3Qmm2NKk3IVGivtezQUxn8pIW9T6iaIAVe5QStiiU4gPOivOXUc1WvzKTSIBIaYsya3nVoIgdINGDJnagQWfgOaW8SQQQhDXnbyXcLxOJjHeCYnQdENgmo9l/rA0xcvx6s/XYyGZazOQkViQwwcQk5UVAKIUHnMxgE6lrvcGlGDwnIwT0VLfsepvZ2n+sCDD6ykwiAnaVt1mYkEQAQRMRe7N+s0ik3a9GwiJe26QKRIDeV9XALkXbJCVmYhO7xAASAaknAJx2/kaqOU3g9I3EgWJjsEGn40KgjKEzmKJFQCRKdSuCgaan5vUGn94uAhjM/mkdjiDnL3b+MmF+s6XHNIGDF9kxPTunFw3Q+6o36zealEDH2cfaIyVGCKioXR4YOlFNpjMxIRGQghEAJ52/2UBKMxAAIkFgRQSYdWYz5w+DQWY2ALnBIIkdfEaDTrQ1R2bggYQAEUDHL2uLZGb9Rl/TJCcger+TEQGytsmK84/9WdX5/Hr5TnpRASdFAEUAAjDwRANOL/QeG1bTG2Ci70UiwEidy+QCAOLymkaDTGawqQKVzQwGm14oTm+ngN2BR9EAIlWdv57z9WpSIjM5MbNNZmv/0RFJkT1SY6KWsRMKPVGgxNjC6GtVLdqiQNqgUAoNPFnnb6auowdV7PfRg0jvZ72/M/o/QN3MW5GaNVpni3X0ZoPMSAyoAgWuF4oT7RSgvAAiVZ2/7Hq/1WikrLO3IgaMEgNlcwBiC4qJ1vnTqhx8tCCIdf4sZkKh930k6jqNlgZikw5TVgSEUmTgyR57KXL+eg8Zpy8rBPRUt5WBFo/Kjn7eaOApUd/LRAU4xEsCtD+XIOevP87jXYKUmZgYRSrtRietTEz07FKsCFCi7E+081d1fo6e1QN1i5npfdWLHqScCEjlQkB2kvxivzdy+Gk6A85sIDIAyhmHs1YjDkH37m1Zx5aN0bZ+NppkhJCbEUJOegg5jEEJR1BWXomiolLszi/G9q27+daFa7Hmyz/46t//wR7UDf9XO/g0gxm+7MAD9Kt2QSIqINqaY0kE8O8UEgFE8hmYEapTzt/OGr/IsadJTFbMhAAAKIN6oPFph7EuvTuhc+smrHWjXLSol40mmemoF0pDFudQK8MoqdAexYWl2J23B5uXb+brvpuD5Z/P5NsM7JKe/YlNBKy2SaLJUewELyIQAUaRx5SZaATpOGDR7N8ss1bW+RsNqjQdR59m8Hyt77MzEHrgPNZrWD92WJfW6FsvC83jab/CUmxfvRULZyzlfz/5Bf97006Uxihuvdl+JEZd60UB9J6LVfBGOQZG+QmiIz4hGoQkAgifOn+Z9X6j2X9saF7WPhk9lyYQDwyA0q4Zsm8/nfU54gDWp0tr9K6fjRbxtFNRGXas3ooFU+bzPx74iC8qrUBYx6bE2qaIjq2KGHxvZJ+MkqL1di8ZHYFuJBikSTp/GxABYCX0L7u2pjco0gxm+2kGgsBIIKQN7sWaPnQ+G96vC47JyURjN9oyoqJ81RbM/34u/2X0B3xBaYWpc9cTAkaDUjUYuCrM6w2IDiDyjQgwMfqERyR5P3Bj15HZEmSahahknffIzkDawxeyvif2Z0d3bYN+aQoy3Wi3knLsmb8a0+77kE+avojvEjj1iOBnMzulN/Exs0WyNshyvyMB4J0AcML5K4IBJRIBho9TB7LWYy5gZ+3fHkcozLslmKIy7PxjGZ967zg+dc6KmmUC1WSAyShxIwEgigSoMF4ftCQC3HAA5NhJKDjUT+LddWSW1Cdy6mkCZ68nCpRDuqHxmAvY0MP2Z0PrZaGZV/dF5Qgv24gZ947jn301i28VOPiIifOPmNglp0UACYAkEABmoX+z8pmyzt/M6YdEz/XcB/XfvkE5q/++GO6l49eJClTMX43p947jX0+Zz3cInLyZKIgn/GZ05KedUJwt4+6ykycB4ZIPTxZxIOn8nVjvt7sMaWavat5vWD/WfMwF7JR+XTA4TUFGom6uyhGeuxKTLntB/WzJehRG2Zawjk0KS9grKyJAFdggx5YCSAA4KwCsrvsblc00GmwyM/2Q2XOvX8sGXTCEXZqd4U6o3+5gW7gG0298U/3ityXYaSAAVAvqWzTojMRAbETATAS46gQccOzMgfcgJx//a5Khj8g6f70IgNGWPitLkWkmNkw5sieaPX+FcnrvzhicyElJLKUV2DPuZ/7OlS/z3yWcfthiZEBvNxQ3mZSYTUKk+xsJAPcFgEzoX2ZtTeT8QwY/1/ratwsafnanclXX1hiYrNY2HEHZzGWYdMlz6tdr81AcZ/hNFBHQq0XADQZgIkUAs9HX/BAl4AG7PrO/5S78H6ecvyJhi8yy+W0vQ3Zqidx3b1JOOXx/DA+lIStZbdOqrZh11uPqawtWoyDG2YcNnH8Y8ssDZrbIlaUAEgDOCQA7oX8riTUyM/5oh1/r+dtOZz3uH8luyvVwLS0eisuwa9x0/uHVr/CZNkWAUVRAtTnwzJID4zXmLI7n4v27REcBuM+uKx7Dyx18L5n7GW+yn0xdEduPV69hh18wmJ2fm4WmPrFLOx8cz5976gv+T4yDDxsIAdmlAbsiIC5hSQLAXQGgF/oXba2JzfS36vxDOiIg9NmdbNjph7PLFIY0v8VfN+zAkmtf5W9+O6cmGUc0uMKQT8YxC8FZEQGwKARkHDSzYODtOE03lgeSZfAyF67Z7utk+wV3QBSYHdkt6/zNliDNopIhs0nK/x3CWr98NbuiQ3P09JtNUjkiX8zkb5/1OJ8S5fjDMULAqggQ7RAw2rIMiA87IwHgkQCwEvqXqe4nCquFDGb7dX7OCCE08ynlsv77Yjh8TDiC8u/+4p+d/Tj/viJsGG4TCQKZREGRAgfEeQHxCgBmwaDLvj4ecUDYd/KQnJVxi6+3KwCMopB2qowaJfWFIJmHlBFC6NM72YkjDmZnhdLc2c7nFXNXYtLht6lvV9kkMyFgZLdEuUqydsh2FIkEgLsCQDb0r7fGFj3I9Gb61T+n6zn/7AxkzH1eua5HBxwRFKu7eReWXfESHztpLs+D3BqcnWUBmUIdZoOPW+wrMrM3q6+TFQAkCqzP/K06fC75fnZEgcz9lnX+Mhn+Mg/dHKTh/VnLN69jo9o2xf5B6Rz/bMCM/jeqL5VWoMLA6VdCf5mg+mejCKVMRNJoMkICwEMBIDv7l0m0USTCarGz/fTY75vUR9asp5Ubu7XFoUGzxhVhlI77mb97+Yv8N0GoTVYQqCYDT4VclS47yYBMYmbPTBy9FTFgN/LghgN1dIh6cK1WBJ6MMzdLIjVbYrLSt2SqjSomExHZnUchGCxNvnU9O/KCIeySjBCyg2aTVmzGnwNvVZ/fXYiyKhtSGWV7KnWiAmbLlTL5AKoTUQASAO4JACuqW0Zp64X8ox/pANKaNUDO7GeVWzq3wkFBnpYtXoffht+vvrN5F0ogTsAxWouTKdQRz84AKyFaWWfvhBBwM0EwmQYvc+Ca7WTzyzp+J0SBjLCUzfi3UmhMFJGsZafaNkXOpAeVSw/siCODbI/WbMO8ATerz+zci5IYx6/3kMkLENUJMIpGkgDwWADIJP7J1NK2MvOv/jk91vk3rofsBS8qd+3TAr1SITa7pwhbrn2NP/fxL3yDhMqWXYOTKRpkJRvXiqEWzeBk/8aOCEgGAcAdnt27IQDsOn9u8jpu8W9kP7+RLTIL/VvJQTKMTp57NOvw8lXspsb10CYV7NH67VjU93r1sT1FKNURAZUQ5wZY3R1gFo2U6uMkANwTAKICG0ZrbXrO32jmnx4tBNIUZCx+Rbl+//YYhBSiMozSl7/jr938Fp9tMOMPw/5uAavbcqzOzsxm98xEBFiNIsg6f6fC6l4NZjev10p2vmj2LnL+3GaUwGoEIN6aIyED+1QnIvDs5WzAtSPYVekBDPmLWLYRvx94jfpiRK3JCagURAQiBvZJLyoZPSGRKVhGAsBlAWA18c9q6F8U8o+d/Yf+eFq5eOB+GIHUhE9byL8edi+fEFFNB5lMoqCdet2yDo9JfGUSkQAGa8sEooiBk07ULXGQ6OuzkshnJADMZv4yxaas9jEWpx2SzUUKVU1EQlPGsDOP6c1OQYommM76F98ddqv6XpQACOt8LxsJkLVDtkQACQB3BYDsepvRlhqR46/5+dM72PCzjmCXO/WZf1nMMXE28NcKjo07gZ17tecb5ACdWgIHdGA44gBgSG+GtklUvmP1Vsw//j71lVVba+p2i7biWFmDk40CiAy0bIa22RpuPJEBMxFg1QH76QhkFsd1y27fszrTlxEBVneaiPb9683+reQgCbcgd22N+pMfUq7p0hr9ku3mb94F/LyQY8ZSYOkGjrV5wN4S7XfNGgDtmwEHd2M4aQBw9IHx65bPZvC3zn6CTzJw/EbRANHWZTt5SSQAPBQAsrN/UaKNTNi/1tcHzmV97h3J7nKidvYXMzke+YxjwWrZtgEO7Q6MPIrhwiEMDXMTf7/2FGHLxc/xZybO5ptgfU+ubAjOrEa3zMxf1rmb/Sya+buZHBjvrN7NCIAT1+3Eer+ZwzebvckWnjKLMMUmIMsuQUrXHjlpAGv33k3slmRa7y8oBj74mWP8rxx/LgdkXUvfLsA9ZzGcfrh9IaByhMeM54898DH/O8rhV5oIAL2JiVGCstUoAAkABwWAE7N/0TqbXrJfna9D+7BW393PHs9MR4N4PuPuQuCi5zi+m2O/7XOzgAsGM9xxBkPHlom9Z2UV2Hvne/yZFybyFdDfhiNTpUsmKVA2Ccdq2F+vH8m+XvR/ZKIAboRt3RrUXlyr3e18MttFZU59A6wtB8jUHrFyyJhZtdH0G05i3R6/mN2SlRGfHXKKdXnAE59zjJvOUVxm/31GHMLw/k0MTerb+/vySuwd8SC/c+rffJtABFRCnK8ksz3QdhSABIAzAkBm25/ZoIsdaOkCAZDeuB6y/3lVeaBVY3SLd7AcO1rFqq3OtFd6CLjoGIaHzmNo3SRx9y2iouKV7/irN7zB/4RcuU47+QBW8gBk1vOtzv4Z5HIGZESBG441CEmAMs5e5LC5zZ9l8wbM+pmo5LiVdX/dyOQL/2OHXjOCXZ3IY3ur2bobuO8jjvencVSGnXnPrq2Bnx5WbE9qtu3Bih5Xqw9U7QyoFAiASshvWZaJRkpFAUgAWBcAdmb/ZgU2ZBL+0qMffzytXBRv0t+OAuCwW51z/tFkZwC3nc5w55kM2QkyDZyDT5zNx5/yMP9OIuRmZTuOKmGsZQSAWbVII1Ep6/it1g5wY2Ydz3G6Xh9nbHf2L5vcx02MtaxAgERfMxIAdrcf17FPX49mI04awEYylthkv9IK4PEJHE99wVFa4fz7d20N/PG0guYN7f19VVLg+1ECQE8IiBIDzQqW2Y4CkACIXwBYUdxMQmkbzfwzqn9+6HzW995z2D3xGL+IChx9p4rf/3G3/bq0Bl65mmFYv8TZiFn/4scjblc/qNqaY7YUEIZxjQCz8pxmzoxJ9BkG82UAo9cB4h0CZhGAePIAuEOvcWrGH891x7PVz2gZQK+fqCavk0kUlIkAiMqOG0UiDUP/aQoyZjypXDhwPxyXaPs8ZT7HNa9yrN7q7v8Z1AP45XEFaYo9YTnmE/7IfR/yBVEOv0IyEqD3kDk0SCp5lASAMwLAzuzfKPHPaM0/A0B6705oNPMp5ZncLDSO53M9PoHjrve9a+tLhjI8d0XiEgWXrMfMQ29R3yguQxniXwrQq8wlGnR2nb8dUWA2+7daPtiTYI0Hs/t4rsuJhD8rzt6uCBCVIDfKQ7IU+s/NQtafzyj/67kPDk/kjSkoBm56k+Pdqd7ZsMcu0iKadiguw57Db1NvWbgW+VVOXk8A6OUEiJKT7UQBSAC4KADsrrdJhf0BpC96Wbn2wI44Kp7P9M8GoO/1KirC3rZlh+bAuFsUHJmgA0BXbcX8w25VX9pRgFKIdwWIQm9GWwJFMzMnnH90+F+0FGBnGcDu1sB4HXy8AsDtazWbRVnN9Fd1vo9XBJhFmsy2/hktRdZZBmjeENl/PK1c1zXB2/x+WwJc8IyKDTu8/b8ZIWDBiwp6dLD394vX4dde16ovo+5SgNnugHjykkgAOCgAZJP/jAacXrgt9mAfQwEw5nzWb/Q57O54Dd9pj3B8NSsx7ZymAHefxXD/ucxuOC0uNu7EsqPuUJ9dm4cimJcNFu3HtbIEYOVM9tgoktXIgFM1Auw4WB7n76WHpcPCwOrav5WsfysPVVIcQKKvyWxDNktErrFRnVqi3q9PKDe3b5a4k/wiKvDgxxyPfsYRURNzDacOZPjyHtvmlz/8CX/03g/5fBMBYHSAkNHxwWYTEsP+TQLAWQEgU2NbNPs3nPk3a4CcNW8rz9bPRlyb7P5eA/S7QUWim3lwL4ZP72C2E2viIS8fa48brT61aB3yYZ4QKJuAI5MEaLZTxCiK5FQkwEgEAPLLAQzO7feXfR8vdiyYzfrtOn+Zmb8qKQhgo6/JJiIbJv716ohGPz6s3NayETolyl7sKADOfoJj+qLEGi7GgPkvKOjT2d7fF5Yir/Nl6s1VhwbJRgJEy5Ki48tJAHgoAGTDbTKz/1rr/gDSJz3Izjj+IHZOvJ8nkbP/WNo1A766R0H/fb3/37sLsfXUR9QnfluCHRCfFyBbkQswX5eViQAY/SwSC9HP64WBRV9lIgFOONR4IwJeH10su+ffKEPfaM1fb5avSgoCmWUAUURStgJpjX06sieaf3WPckeT+midKDsxdyVw6iMqNu1MDp8QZxQAk+fxT4bfzz+PcvrR+QAyUQDZZUkSAA4KADvJf7LlNY1m/xkA0o8+kLX46WH2fCgNWXHOfNHuIhXhSPK0b1YG8Pb1DOce7X2+V2Epdp7/NH9y4my+BebVAUUDzk4EQDERAFbEgEwUwM1lgHhC/2Z/G8/sn9m4Lqvhf5mte1advioQDnYjALKV/6Kr+7X58FZ2e/1sNEuUffj4F47LXuQoq0gemxVKAza9r6BlI3t/H46g7NjR/MZfFvPtUQIgniiA3vZkqSgACQBnBIDMXlvRHluj0H8GgPT5LyhX9+2CIfF+lme+4rj17eQr384Y8OB5DPee470IKClHwTWv8mfem8rXwnw3gN0IQPQHU2BeLRI60aR4lgRqXUe3tsjt0prlNq2PzEa5yGrWAFkNc5EdSkNawxzkpClg9bKRnabUvB8UhrTcLJYlNmw8UlqBmtprZRUoL69EOKJCLShBaUSFml+EkvxilO8tQcX2ApR9N4dvF73niENYixYNkdUgBxmNcpHZqB5y0hQoDXO068tMRygrA5nVr8/OQFYojaWJ3rO4jJepHDUyOKJCLSpFaUQFLyhBSTiCSEExSnfuRVl+Mcp2FaJ89VZevGIzig3uczwhf6Nz3o2MuWogSOxGAHRFwMVDWadXrma35GSiYaLswphPOO7/iIMn4YkTT1/GcMup9u3VgtX4ud8N6qsGAkBPBMgcGGSlRgkJAIcFgGigidbZhLP/MwexDp/ewZ5hDGnxfpY+16lYuBZJy8VDGd64liE95O3/La9Eye3v8ude1EoHi3YCyCYC6s1CRdEiPYcvIwBqxMRh+6NJvy6s6b5t0LR9czRtlIsGjeuxRvWzUT83Cw2yM1A/KwM5GSHkJrpwS63GGaFeLprN8u+Ut5PlWjkHrwijuKwCJaUVKCwuw97CUhTuKeL5+cXYu3EHdq3cgl3zV/NdfyzD7hinLSMARIJAdsspIH8Oie4OgOtPYt2evITdlJmOnES0c2UY+N/LHO9NTd6zpnp3Av5+SYmnL0XOfoLfMuF3vsFiFECUn6TC4jIACQB7AkAm+c9IbRvV+s+IEgHVa/8ZS8cqN/boEP+e22UbgR5Xq0h2junN8MXd3tcLCEdQ/uB4/vLDn/DF0F9vM1LbsTO+6sElIxgtOf5eHdHg1MPYPvu3R7sOzVnLVo3RunE9tKyfjeZpCkLwIWvz8G/VLDxcVoGKqshBWUSFqnKoA/fDkX78XBEV4cJS7NhThLxte7B1ww6et2wjNn31B1+/aB32xikEjAx6rI2K7mMyFQBDo89hB94/kl0bSvsvquIlBcXA6Y9yTFuY/AdN/vOqgv3bx/H3GzDzgFHq81HOvwL6hYJENUvMjgwGBDtISADELwCiH3qnbInC/0aJfxkA0k8awNp+PZo978TsP1nD/3r06wJMfkjxfIdAREX46S/563e+x+fB/hJArDE2C//rLgPs1w65Fw9l3Q/phm6dWrLOzRuiQ24WmoDwPcVl2L2jABvW5vE1c1ZgxXtT+fJ/N6EYxuF/s2UAoz5naQng8YvZQbeexq5MlJjcUQAcf5+K+av9cR/jXQbgHJFTHuY3TpzNN0cJAJmEQFHJ8uhdAaZbSEkAyAmAeML/MkV/6jh/AOnzXlCu6tcFQ534HEPuTvwWGivs1w748WEF7T1OP1I51Dcm8/eufoXPhNwSgFkSoNkR0QyA0rge0m88mfUY1o/13bcNDmxcD+2SKVRPuAfn4HuKsGnlFiyeMp8veP4b/s+eIlRCnBgIiT5nlJtUZwng1WvY4f87nl2sMCiJaIONO4HjRqv4d5N/7tvgXgw/PxrfEJ2/GlMPukF9DbV3BOiJACvFgaSXAUgA2BcARiFcvX22evtrdUv9Vn89oAMa/f2S8mq8mf+AdlhG47NVlFf6yzDu00I7iWtf708Y5x9O559c8Az/GdbqACBmkAm3/jXI0c51GH4QO7JzKxzoxL0m/E84grI127B40jz+230f8gV7S1AJuS2BEIhNQ/s07hY25PzB7BwkqPTyyi3aiaTrt/vrPmWmA3s+VeI67CwcQVmf69Srl26oVSLYqFSwXr0SkX0yqiVBAiAOASBa/xeur8E4+S8DMcl/39zLTj5pALvQic/w80KOY+7hvjSGrRoDPz8a31qbXb6axb857RE+KQ6FrdtfTh3IWt1xBhvWpzMGZqajPgjCgPJKFP69BrOe+JxP+WoW3wa57YDSEcov72HDTx3ITk7U51u2ERhyt4pte/x5f6Y9wjCkd3y6aeJs/sHJY/g3qJsMGCsCRDsCREnKRv0l6QSA4rP7L1uSVVQqOE1vYB7Zkx3r1EXOXOZfA7htj2Yglm30/n+fOpCd/NPD7AyFIRM61Rmhv23T8HHSANZ+yVjl+i/uZk8P6I7jyPkTErPM+gO647gv7mZPLxmrXH/SANberJ/J9FWFIfOnh9kZ5PwTb1urbL2uHzDwGZD0OQzw1zKi4vPxKropCsz3eKcBUG45lXVvlOtc5a15q/zdqIkUAUP7sKF/PqtcmJuF7Bgnb+rwqx8Nc5H908Ps7K9Gs0cP6IABtLZPWDYsDOyADhjw1Wj26E8Ps7Mb5iJbtv/F9tvcLGT/+axy4dA+bGiiPk8QnL9TtrVRLlrfcirrjtrRY1F9EEVisulL/BgBAMwTvYxuaOyDAVBGHsUc3fo0dyWH36kWASs2e/+/D94Xhyx8SRnVsSUa6Dh+4ez/yJ5osfx15Z6hfdgJCvPnVj0iiQwkQ2hoH3bC8teVe47siRYSUYBaz3VsiQYLX1JGHbwvDknUZ1ixORjO30nbWmXzTX2DiW8RlQInAeCC4xf9zCSFQa0bnBFC2gEdnBuc+cXA5l3BMH7b9gDH3KNiXZ73/7tLa+w7+xnlxkE90ALGYf9aYdbh/Vnb7x9Q7mzZCB1AEA7SshE6fP+Acufw/qwtxEtRNc8P6oEWs59RbuzSGvsm6rrX5WljOAjOH9Bsa35x/O9zQAcckhGqNfsXOX+ZmX+8J3uSANBpOLNa60anrMkUelEAKLefwXpkZThXfnPp+mAZvk07tYzhRIiaFo3Q8seHlZvuOpP10pll1TK8+7RAg49uZVfXy0pcKVUi2NTLQsOPbmVX79MCDaAf8q/pn3edyXr9+LByU4tG8Z0mGq+zPHZ08hzqk0w2NisDDW8/g/XQcfxmvsPI38j4qKQTBX7OAZA55110TKcCgJ3Qnx3k5EWt3sYRNFZtBYbdq2JHgff/OzsDOY9exC6c/BA7uV5WzTpsrMFNf/9m5f8a10vcISpEatC4Hpq9f7PyfzoRgHQAGfWykD35IXbyoxexC7MzElPaF9CK/Ay7V8WqrcG7B07Z2CrbrxchFp3+6fvEP78LAJkKgTC4sYj5Oa17W/Ry8uISES73RHVvAP7vIRUl5Ym558P6scNWvaVce80I1j3G+KZfeizrcuQBiVtjJVKLIw/AIZcey7rE9sNrRrDuq95Srh3Wjx2WSKdQUq6N1aUbgtn+TtnYKtufFuP4Af2lADN/k5QzfDP8lCTFJEUABFGAWipuUA80blIf7ZOxcyYjs5cDZz3O8eU9DBkJ6DktG6HFy1exi249lW3+6W++dPVW5PfqiOanHcYGMub7HS2EXwwRg/LK1eyCY3pj1qJ12NGlNRod24cd0LEl2ib62irC2hidvTy47e+UjW1SH+0H9UDj3//BdhgfAAaYbwesfp7rfE8CwEHHD4mwi8wZ8AoA5bzBrIfTqi0vP9jG7/u/OC59Hhh3CwNLkN7t2BJtrxjG2oIgEkRWBrLOPZoNPjeJrolz4NLnOb7/iwe67R20sey8wazH7//wnTAO/yvQCv7I+Bw9X5XUN8Ov2wBlIgGm6zX9urDuTl/g9oJgDz4A+OgXjrs/CP7nJAg/cfcHHB/9Evxx6aSNjfEBln0IfJr97xcBIMqmZBI3DRBsB+zYAl2dvuDistQwNo9P4Hj1BxIBBJEMvPoDx+MTUmM8Omljq3yA1e1/Mtn+vqgLkMwCgEm+Rq+xTW9WdgbSnF7/TyUBAADXveaPc8QJIshMW8hx3WupMw6dtLFN6qN9dkZNCWBZ/wFY2wGQtCLAz0sAZhEBvRtZo+5OGchah9KQ6fQFllakjuGJqMDpj/KEVAskCEKr8nf6oxwRNXU+s5M2NpSGzFMGstYwTgJkJj5G5JeSnqBsA4SJ868jBgZ0hyuH3laEU8sAFRQDJz6gOlKdiyAIefKrxl5Bio09p21slS8wWz428ze+c/5+EgDMxmuFN61zK+cO/4mmsCT1DNGqrak3CyGIRFIdfQtioR+vbWyVL5BZx7fjh0gAOCwE4inJWPN3rRuzFm5cYEZ6ahqknxdy3PQm5QMQhBfc9CbHzymaf+O0jY3xBVajADK+iQRAgoSBYVJHw1w0duNCMlNUAADAS99yvDeVRABBuMl7Uzle+jZ1x5nTNrbKF5gl/fna0QdRAJhFA/REQM3fNchxRwCkOh9OpzYgCBpj/qHKF5iF/AMz6/eTAJDNtLTyOgaAZaa7c1BH43qpO5DSFODpyxgIgnCPpy9jSEvhwtdO29gqXyBzzK8TPogEgEdiQbhm48YWQABolJu6A/OaEQx9OpOBJgg36dNZG2upitM21sAX+OpY36ALAMdLL2aE3BEAjeul5sBs2Qh48Dya/fuVVVuBtheqKZlV7kcePI+hZaNUjQA4a2fi8AWyUQASAC6LAsvPKwyupOs1rZ+ag/KJS1hKRz/8znNfc2zZDTz7FSVx+mUW/MQlqSm4nbaxOr4gLt9CEQBvHL3s73Rf49YSQLtmqTcgjzgAuHAIzf79zNezNMf/zZ8kAPzChUMYjjgg9T630zZW4Atk9v/b/R0JgCQRESQA4hs8ePFKJWFHAxPxsy4P2LJb+37LbufOWydcNmpMG3uhNBIAfvYZJAASQERF2MedM2kYdSIl/vmdOStqz/r/XE5RAL/Qp7M2BkkAJJ8vIAHgDDzOv+N676GqcOXYnq6tU2cwtmoMPESJf77n7zW1f160ltrETzx0HkOrFKpq4rSNNfAFPMaHeOm7SAC40MA8RvVVunFB3dqmzkB88hKGhpT453vWbKv98+pt1CZ+omGuNhZTBadtrI4vsO1XKALgvqPnBl8t3ZCKMErduND62UDbpsEfhEccAJw/mGb/QWD55tpDZsVmWgLwG+cPTo2EwLZNNRvrJBZ8gZGv4QI/RQIgCaIBdX5XXIa9bl3IAR2C7RhDacDLV1PiX1BYtUX8M5H8MKaNyaAnBLphWw18gSV/QhEAb506l/g5+lHntUVlKHDronsHPCnumhMZenUkoxsECoqBorLazxWVIeXOmA8CvTpqYzPIuGFbo3yBZT9iw1eRAHBQDHCLDV4TqiksdS8C0KdTcAdgq8bAQ+fT1D8obNtj7XkiuXno/GAnBLphW6t8gUzCnxM+iASAw4JAL9vf6Lmax669fJdbF3ZQ1+A6yKcuZWiQAyIgbN7FLT1PJDcNcrQxGlTcsK1VvkBvti/jU3zl8P0uAGTDMbHPxd5cvjYPruU6d2sLNGsQvMF3xAHAeUfT7J8iAEQyc97RwUwIbNbAnV1WVb6AwzjkLzPLN/JNJAASIA644DkAwPzVcC3ViTFg4H7BcpShNGDsKEr8Cxo7DRbCthdQ2/gVxrSxGrSEwIH7MVfsj44vsORL/IwftwHKvk64DDBlPnd1t/PhPYI1+K77P4ae+5BxDRr5Bsl+uwupbfxMz320MRsk3LKpVb5AJvxv1xeRAHDQ6RuF9o3Um66CW5eH0qIyuJYHMLhXcAZfq8bAA+fS1D+I7CkyEABF1DZ+54Fzg5UQ6IZNLSrDrnV5KJWc9cv4Hl+JAT/mABg1qkziRq3Htj1Y59aFHtQVgamS98xllPiXahEA2gbofxrkaGM3CDTM1Wyq01T5AG4ycRRFBOxGCEgAOBAFkFVouqpu7TbuWtXzNAUYfKD/B99RPYGRR9HsP9UiACQAgsHIoxiO6hmA2f+BDGkueKsqH2B35i9zXgDVAXBICJjdCNnnah5/r8EaNy/6uH7+HnRU8S/47C3Rf76wlNomCASlQqBbtrTKB3CJKIBsUqCvEgX9ehqg0VZAM8evRv/8yW98lZs36sSD/e05r6fEv8BTEdbv/iXlVAcgKPTcRxvLfsYlWxrtA3R9hMCnmPmjpJ/9+ykCYKVRq28iYLx+owJQ569Gwe5C97YDdmgO9O3izwHXpglwPyX+pWwEoLSC2iZI3H8uQ5sm/rz2vl00W+o0uwuxZf5qFFT7A4jX+1VJ3+Mr/FoK2GytxkjRqbEKb802/OPmRZ820J9OlCr+pQZlFdaEAeFP/Fwh0C0bWmX7ucA/qJDPD/BlImAQIgBGN0QqlDNnBV/mauc9zH+DbnAvlnKJf0VlwC1vceTlp5ZjKK/Uf15Vg/uZ8/K1ex17CFLQGXkU8+X2ZLdsaJXtl106FvkaigC4PNM3+p3V5I1olacCUF+fxBdzDtfMXY8O2sMvpIeAF69kKZX4t3ILcNANKp79muP7v1Jr7dtopr83wEmA3//F8ezXHAfdoGJlCh19zJg2ttND/rlmt+wn55rtj/UHFn2JTC2ApI4M+CkJULQv0ywiwA1usLpoHfZu3YNVbn6Ac300m061xL+Fa4FBt6tYsVn7eerfqTUrTMVUv+p7vGKzdu8Xrk2dz+63hEC3bOfWPVi1aB326vkEgRAwS0j33SFBfi0FLLMDwGgtp47aW7iGL3Dz4kce5Y8ZddumqZX4t2orcOxoFdvz/3tu7krKfg860fd4e77WB1ZtTZ3Pf/+5DG2b+iNi4dZSZJXNN/QJBt8D8uF/2gbocjTAKDQTfbNUiLd4qADUCb9jvpsX3bkVMMgHZwM8eQlD/ezUMII7CoDh96nYUVBXFFACHMADqoP2lqCOszfqC0GlfrY21pOdQT002+kGVTZflfQRgPEWQaMogC/w+2mAMusyaszNq6P23p3K1xcUw9XDga4YltwDbnAvhnNT5KjfknLg/x7Sn/VxDqzbnjqO3jAHIKAiaN12fXGzaqvWJ0rKU+O+n3t08icEumUzC4qx7d2pfL0gAqDCPPkvECcD+q0QkEh5xf6NGnUDVRgvBUQAqPNW8VlufogzBjE0StKzAdJDwMtXpU7o/+pXOGYvF0UHUmcZgKfYiofo3s5ervWNVOHlq5I3IbBRrmYz3aDK1tfYfuiH+6N9hwq59X/Zw4FIANic6cs0vlEuQGwEoNZzb/+EP9z8ANkZSNoZ9g0nMV/tVIiHN6dwfPCzeFyWURGcwGJ2bz/4mePNKakhAnp00MZ+skYosjPcee8qWy/lFyBfc8bMX5EAsDnrN/qd3lfVYLavp+5qqb+Pf+EbdxVio5sfKhmXAVIp8W/BauD6183HZWY6OcqgInNvr3+dY8Hq1GiPZE0IdMtW7irExo9/4RuhEwWW9Bsq7GX9J6UgUALSj40OZBCpujod4Pel/Dc3L7JPZ6D/vsnVcE9fxlAvK/iGriIMXPScKjW7b5ibOsshqXbQk8y9LavQ+kpFOPjtUS9LswHJRP99NVvpBlU2Xib8r7cl0Hcz/CAKADunNuklANZ57uFP+QyVw9Vhf10S7cEd3IvhnCNTwwM88inH4nVyr+3eNnUcolG556CWgZa9t4vXaX0mFTjnyORKCHTLRqoc4Yc/5TNEPgBy4X8zP0QCwEWnD5hvB7S6DMABqHNXIn/lZne3BJ5zJEPrJDiUIz0EjB2VGs5/4VrgsQlyY7NTS9AZCAGODDTI0e6xDI9N4ClTJGjsqORICGzdBK5NSlZuxvy5K5Ev8gEm/kJm+x8dB5wEUQFAvAwQifl9TTjos9/5z25eaEYIGHVC4q3rjScz7Ncu+IaNc+C611RUSsZ1ju1LJyAGHdl7XBnW+k4q7JTYr51mExLNqBMYMlwSIlW2XW/dP9oniML/gdn+5wcBYJZQYbVms54IUGM6ROTBj/kit2sCXHVCYtfd2zYF7huZGo5uwu8cM5bKv/68o1NLAKSi3LFyj2cs1fpQKnDfyMQmBNbL0myjGxQUY9uDH/NF1XZex/abRY7jCf8nbQfy23HA3KSBZQo7qAIRoEZUhKct5D+6+UGaNQAuOTZxpvfZy1Mj8S8cAUaPkx97A7oDR/ZMLWdomAMQ4IqQR/bU7rUso8dxhCPB7wv1sjTbkCguOZahWQN33nvaQv5jREUYddf7IxZ9hlnGv6+iA34+DthoG6DRnswI9JcF6oiAW97mv1SE4WottNtPdy/UJeKY3gxnHZEa875v53Dp094UBjx3hYJUw2hbnBLwpnjuCgWK5DBYuUXrS6nAWUcwHNPbe/uQEdJsohtUhFFyy9v8Fwnnr+crYn2J3W2AJABcigiYrf2rMM4HiF0PUgGo6/JQ/NcK/OLmxbdrBlx2nLcDLT0EvHx16gR9x35vYZZ3DsPA/VLO/yMrw1pkICgM3E+75270Jb/z8tXeJwRedhxDu2buvPdfK/DLujwUi2y+gRAQzf4DkQ+Q7AKAmzxndiCQ0Y2M6CjAWmtDo8fxH9zeEnjXWd5GAW4+JTUS/wBg9VZg2kK5cXnhEIYHzk3N5D8jR+9WFbZk4oFzGS4cInffpy3kWJ0iJwbu106zFV7O/u86y72tf6PH8R9iHH/ExBfIHBLEBf7IzIeRAIhTEMisvxjdrNiEj4he5/hlMd+5aC1+d/PDtG8GXOpRLkC7ZtZmPH5nynxumr3NGHDb6Qzv3sRSriDOf8ZX/4PnZAa/QRgD3r2J4bbTze8/51qfShVGn+PejDyWS49laO/S/1q0Fr//spjv1JvkGfgCmb3/dnwTCQCXBIHsMoCo8IOqJwIe/pR/y7m7N/TOM72JAqRK4l81KzaLf9+2KfDjGIYnL2HSa8GpFAFIlWOhFaYdjfvjGPMMeLM+FSS8SgjMCGk20BXnwMEf/pR/a+D8rfiGQIb//SIAuMDpA+bJgHrLA7HrQLpbAr+YyTcv3QBXTwncpwVwtct1AYb2YThzUGp5OSPH1qIRMOZ8hn9fVzC0D+35b1xP//mGuanVDkP7aH1izPkMLRpZ61NB5cxBzPUxcvUJDPu0cOe9l27ArC9m8s0w3vpnlAsgqiZr5HOMkgZJACQgEhB704wSPPSWAiLRHeaBj/kXnMPVTUCjz2GuGZeMEPDSVann6K46geGgrkCaoomsc49m+Pwuhg3vKhh9TmpFQ0QYHVGdagKgetY7+hytj3x+F8O5R2vOKU0BDurq3h71ZOalq9yLUDbIcW9ZknNEHviYf6Fn0yHe92/kJ4AAFgIKBeAzcPxXz4RLPKo7AIN++F+JjQIsXs9m9uqII936AM0aAHecwXDPB873qZtPTZ3Ev2jaNAHmPp962/qcEgBN6qVum2SmA6cfznD64UBqlkr6j/3aaTbk8QnO26Y7znBv3//i9ZhpMPs3WgaIQFwASM/x+14E+NVCyiwD6B0TrLff0ygcVNNx7vmAf1lVRMI1bjzZ+TMCOjQH7jmbwtyEMUZLAE3qU9sQGveczdChubPv2bqJe6WHIyrC93zAv4Rx4p+qEw0w8hOQ9DW+FAN+OgxIRhAA+uv9XPC8YRJg9fffzeHb5qzAVDc/YE4m8MiFzg6IVDnql7CP0QysRUNqG0LDjSODH7mQISfTneudswJTv5vDt+nZcogT/7iE/4Ckw6fDgDyMBFiNAnATRRi7bhQZNVb90u3qgBcdw9B/X2fe67i+qZf4R1inVWNrzxOpyZmDGI5z6KCs/vtqts4NKsIoGTVW/TLWfpvYeqOyv1Z8jC/xeyVAPTEQq9aMijqYRQFqRQT+XoO9P87nE129GQx46Uol7j3pmenAi1eS8yfMaduUWXqeSF1evJIZlo6WhVXZOLe23v44n0/8ew32Qm7t36zwj2riW3w12/e7AOAWXhPt/EW5AKpo1h+rHi9+jk8qKEaemx/y0P0gXZ3MiJtOYejejgwWQREAwjm6t9NsSzxcOIThUJdKbhcUI+/i5/gkWXsOcT2AaJ+h51vi9VUkABwSBXqZmTJRAG4w2zcUBLsKUfbGZD7O7Q/1xCXMMDvbjA7NgdGU+EdI0jAXdfJE6mWl5jZAwpzRcSQENsrVbJtbvDGZj9tViDLIhf9Fmf+i2b/I91AEIMFRAG4jChC7I0AVqcfb3+Xz1uZhoZsfsmUj4PGL7Q2UZy9nyKXEP8ICXduIfyaIanLjqBD4+MUMLRu5c11r87Dw9nf5PJNZf2wJYLPMf73ZfyCS/6oJSh2AapggXKNGvUZUF6C6FkD01+rvFQDK7e/wcZ/cwXqkKUh360P973iGD37m+GOZ/N8c15fh9MNTZ/a/eRewcC3H8k3a97sKgeIy7XdZGdpMtkNzoFtboE9nhs6tyIDr0b0tw99r/hsq+7ahCBIArNkG/L2GY8VmYMMOoKgMKKv4zxE2ra+VlO7eDujdybyUcFA4/XCG4/oCPy6Q93WH7a/ZNDeIqKi8/R0+Dubhfpr9B1AAGAmCakdf7diVGGXHYh6xCpFFOf1qAcAAKJ/P5JumL8K3Q/uw09z6EIwBr1+r4KAbVFRIVCDITA/2Ub9lFcCsfzmmLQRmL9cc/44Ca92iU0tgWD+Gy4dpVQIJjVhh1LV16rbFvFXAW1M4psznWJtnrX81b6gJgQHdgWN6AwP3Y4bHLfudl69mOPAajvJK89dmhDRb5taBW9MX8W8/n8k3VdnpMPS3/5mdA+DE7N93MM6T6zMxuV7CDH5mOg8lxpkrANKqHkqVCEqLeqRXPReK+j496vsMAOlN6yNn9VvKEw1z4eq88qHxHPd/ZH6P7jqT4dGLgiUAisqAiX9yfDkLmDKPo6jMuffuv692JsDxB9Fs9+NfOM57+r8+9tGtWhncVGLyPI57P+SYu9K596yXBQw7iOG0gcBJhwavJsfd73M8JlEh8MHzGO4b6U5/KijGti6Xq3fsKkQJgEoAFVUioLLqEY76Wv19tCgIw7hOgNExwEYJgaaNkXT+NiACINb5Q8f564mAaDEQivpqKgAApN9/Luv9wLnsLrhYL7QyDBxys4q/1xi/pkNzYNlrimuFNbxE5cD0RRwfTgc+/91Zp6/H8P4Mb13P0KYJUpblm4D9rlJrfv73NSVldpFs2Q1c/iLHpLnu2sF6WcAZgxjOHwwM7hWMEyhLyoH9r1KxYYfxa/p0BuY8qyDdnVgzf+Bj/tiDH/OFUQ7fTACEBZECI+dvdB4ASAAkRgA4FQVQYmb/eiLASACEAGTMeU657OB9MdTNNvl7DTDgZuOlgC/vYTh1oL8typ4i4I3JHK/+wLF+u7f/u3lD4L2bGE7on7rRgDYXqti6WyvRuuWD1DhD4Ye5HBc/Z3UpKX6qTwD93/HMsBSzX/hqFsdpj+j7kIwQMPtZBX06u/O//1qJqYfcpL4d4/T1BIDI+csIAEdm/8koAII00o0KAwHiMsFGBYBE9QFqOtCZj6njC0uxw80P1qezFkbTY1g/fzv/FZuBa17laH+xijvf8975A8COAuCkhzjenBK4JT5pTjlU60MnD0gNEfTmFI6THvLe+QPA+u3Ane9pff6aV7UkQ79y6kCGYf30+8yD5zHXnH9hKXac+Zg6Xs8mmzh2o1wAbuIzLDt7PxCkSoAwuGFGJwLKioGI4BFevx1Fj0/gb7jdKW47neGonrWfy0z371G/i9cBZz7Gsf9VKsZ+z2uy9xNFRAWufJnjrRQVATefytCuGXDLacEXAG9N4bjyZY6ImtjrKC4Dxn6vjYEzH+NYvM6f7fnSVXUrBB7VU7NZbtn+xyfwN9ZvR5GB45ct+iPyCUZ+xIovSnr8vAQAWMsFqBY8eo80g0d1+D86OTBd7/HnM8qlA7rjWDfbZuNOoPe1KvYUaT/fczbDwxf4y2AvWa8lNn4xk0NNwmGTpgA/PcwwuBclBwaR6Ys4jh2deOevOxtj2ha7+0Yy9NzHX+06ehzHI59qA7pxPWDhywraN3Pnf81ejp8OvUV9B/+F+WMf0cl+lSYiwWhHAODg2n/NCykHwFEBoCcCYnMBqh1/dD5A9c9p0M8JMMoF0BMAIQAZ7Zuh3pKxyuMNctDCzfb5dAbHOU9w3yX+bdgB3PU+xye/Jqfjj6Z5Q2DRywqVww0Y2/YAva5VExL2tyoEzjmK4bGLnD+G1y2iEwI/uYPh7CPcEdB7S7C95yj1zo07UYS66/1G6/6xa/96NQH0Tv9TdWb/cS0HUA6A+4gUWuyNNUr4EB4PrNOhwht3ovixCfx1zuHq3OLsIxhGncjwwpXMF86/oFibHex3pYqPf0l+5w9oOQH/eyl18wGCyv9e4knv/AFtJ8zHv2hjZvQ4joLi5L/mnEzghSs12+SW8+cc6mMT+Osbd6JYzwbD/Pjf2HC/3myfS/iRwBCECIDdKEDsrgCjpYCQwSMDOjsEfhzDzjy2r3sFggAgHAFCaclvxN7+kePu9zl27vXn4PhqNKtJjiP8zdd/cpz6sD/td7MGwKMXMVx2XPJvH3TTNv20gH953L18AvQz/SsMZv5G4X+jkwFdm/0nYwQgqAIg2vnrbQ+MrQ+QJhAB1Q7fKCeglhDIykDmqjeVe9s2RfdUNbbzVwOjxqqYvdzfn6Nra22ZJdnFFmHulPa/SsWqrf7+HAO6A2NHKejXJfXu4eZdWN71CnVMWQXKDRy/3pq/kQDQC/3rJQICDq39J6sACMoSgNHN0buRer/TCxGZHgykE3qKlFWg4sJn+SvllShKtUFaUAxc+xrHwTf63/kDwKqtwLjptBTgd8ZN5753/oBWAvvgG1Vc+5o/lgWcorwSRRc+y18pq0CFyPZKzvJF9f7N/ERczj8ZSYWKH2bbAmM7htGpgCIxUGsd6ueFfPvY7/mbCOCakRGT53EceI2KV77zxzq/LE9/ycFJA/h38HPtHgYFlQOvfKeNtcnzUqJj8rHf8zd/Xsi3w3jNPyKw03pbu0Vb/4z8RiAJciEgvee4hYcqiASoZpGAm9/ic2Yvx7Sgd6C9JcAVL3Gc8ADHxp3B+3z/bABmLgPhU2Yu0+5h0Ni4EzjhAY4rXuLYWxLc+zd7Oabd/BafIzHzVyHe2mfF9lv1KyQAfBQF4Do3Us/xc9goDBT1iBx/nzouLx+rg9qoU+Zz9Byl4q0pwZ4lvzeVQgB075IzuvHWFG0MTpkfvM+Zl4/Vx9+njtOzrbBW+IfDvOKfnj8IPEETANzCc0ZbQoyWAlSB4oxVpWEAkfxilJ37FH+hrAJ7g9TI1bP+4fcHc9Yfy2czEl+pkLBOcZl274LOxp3A8PuDFQ0oq8Dec5/iL+QXo8zIvkL+2N+IwM5bXecPVIdKtQiAWaKH0TKA0XqSTD7AjofG85dVl+sDeMWMpUiJWX80haXAtIUUBfAb0xZyFJamiIGLigbMWOrvz6JyqA+N5y//vJDvgNy6v1nellm4XzbxjyIAPo0CQHCj9UI/VgoEme4QeGwCXzJxNv/Ez40aUYExn3AMvktNiVl/LJPnkUOle+aPaMDgu1SM+SQ5yx3LMHE2/+SxCXwJ5DL9rRT8MTvsx8zxUyEg1y+IOVLpggmeN6oNYLVAkNGxwbFfax5LxyrX9eiAAX7rJFt2A+c/zTF9UerOgju3Ala/pYDwD10uV7FmW+p+/sG9GD68laFNE/9c8z8bMPuAUepLMK7vH/1VJi/ArOCPldl/3AaQ6gAkdxTAbHugaN3JNBJw7Gj1zW17sMZPDTlpLkef69SUdv4AsGYbsHorCJ+weitS2vkD2sFHfa5TMWmuP8butj1Yc+xo9U2LM/+IwD6bbfdL6dl/kAWA0Q0zu/GiswKMdgVIFwrashslZz+hvlhUhj3J3ngRFbj7fY4TH/RH/XQvmLeK8gDoXvmLHQXAiQ9qJbmTeUmgqAx7zn5CfXHLbpTAeqEf0RKAqNa/aDk48M4/6ALAqjDQqw5otjXQshD4bQl2Xvcafy4cQUWyNtCuQuCE+zkem0BFcKL5ayW1Ad0rHxo8Djw2geOE+zl2FSbf9YUjqLjuNf7cb0uwM07Hb7TmrwrsfEo4+lQVAFaXAox2ApgVBrL0eG8qX/fMV+6fHGiHv9do5UZ/XECev+6sktqA7pV/+XGBVqb77yRahOQc6jNf8dffm8rX2bWnMC78Y3UHgFUfQgLAxzN+CDqCCv1DIkRiQLZYUARA5M73+Lxv5/Cvk6mhPp/JcfhtKtbmkbHUY+FaEkV0r/zN2jzg8NtUfD4zOdrn2zn86zvf4/Ngba1flXD6el9FNj8lIwKpnNZslulptDXQrHCQdLLgyWP4d9MW8snJ0iBN6gHpITKSRuwuBPYUUTskO3uKtHtF6JMe0sZ6opm2kE8+eQz/DtaT+0SFfcy2/KXcLJ8EgP2lAKNaALKHTpjVqo4Mu5d/uXAt5iRDI7VvzlLqlDG7MyiC7pGfKSjWxnpiIzSYM+xe/qXAlprN/I3yAUS2m0L/KRwBiGdXgNF2Ej31aRSi0u3YERXhI+9QP1ibhxWJbqAZSylsasaqLdRGdI/8TyLH+to8rDjyDvWDiIqwpLPXs61G9f2tbvlL6WRAqmxifhiE0dZAvV0CEQOHr4o6+N4SlA++S3198y6sT2RD/EGn3pmybju1Ad0j/5Oosb55F9YPvkt9fW8Jyk0mSKqBvYxAvD0bMN/yl3KOngSA+IYbHQNptDUQ0E8GNNsmaPj8+u0oHnS7OnbbHmxJVOPMX+3OeEgPASf0Z+i/L5CV4e8ONGY8x/JN5ECSleWbtHvkZ7IygP77amPGrZwct8a6iG17sGXQ7erY9dtRbMdGCmxsrE02st8ie5+SoiAVU744jEsFV998BuNzoaM7GUPd8BOL6cBKzNe0mN/X/LwuD8VD71Ff/flR5doWjdDSy0apDANLHI4/dGoJXHE8w6XHMrRspDVXOAL8uwn4ew3H32u0bYcL1nDfJG0VlQHPfMXxxnUMRPLxzFccRT46ubFJfaBvZ4Y+nVH1YNivHRBK036fl8/wzk8cb07mjuY2LFmvjXmvkn635yNv6D3qq+vyTJ1/9KyfC0SA0VIsbfmzQFDPAjD9NybPx54XoED/rIA01D0roPpcgOrvY88FCAHIQO1zAjKinss4qCua/jhGGdWkPpp61e5rtmm1053goK7A6HMYThrAoEjezg07aouCv9fwpE3myskEto5T0CCHHG4ysbcEaH2BipLy5Ly+Ti01Bx/t7Ds0l/tblQMTZ3M8/Al3rMbB6rcUdG7l/ufeXYhdx92rjp23CrsAVECr5V8R9X1l1HNh6Nf/ry4QZHQUsGgrIGC+7u+JAEg2f5uqm76MogDRz8d+D+jnBTADNarA+EQq0RqWOm8VCk54QH1z8kPKVY1y0ciLBlmXF3/HPKAD8OhFmuO3SofmQIfmDCcN+E+L5RfXFQX/bNRmLomkpBwY/yvHlcMpCpBMjP+VJ4XzTw8BPdrXdfaNcu2/p8KAUw5lOOVQhomztdK+SzfEP+Y7t3K3D+cXI/+EB9Q3561CgWAmL9pebTbLV01m/YDcun9K5gOk8q5vkQiAjvOvDu2n6ahJNSoyIDpSWFTAolannr0c+f/3oPrON/cqlzap774I2BvHuekdmgMPnsdw4THyM34ZGuUCRx/IcPSB/4mCiqqliv+EAcfCtdrsz0vem0YCINl4b5r3NrxBDtC7U7SzZ+i5D5DhomU9aQDDiEMYPpjGcf9HHBt2eD/mJWf++SePUd+ZvRz5EIfuzQr6iHZfxc7u9Qr+6P2c8s4/1QWAjEBAzAw/NjcgNgIQnQOgwHw/qkgs8N//we5h96nv/jhGuaxxPTRw88PacdzNGgB3n8Uw6kSGzHRvbkpGCOjXBejX5b8VGs6BlVuA4fd7d/zrn/9q+807taSBkgyszdPuiVd0bgVMelDBvm0AlgAdqDDg4qEMI49iGPs9x6Ofcezc6/6Yl2VPEfYOu099d+5K7IZxWXWZ8utGhdiM6vyLvidi+wA5eennjZYBZA4XUgXfqxCcS52TibTcLGS73RBtm8pbg2YNgIfOZ1j9loKbTvHO+RvBGNCtLfD+zYqnxvjLP8iuJAte3gvGtL7WrW1inH80menATadoY/Gh8xmaNXBnzFslNwvZOZm1oqV6dlM1sY0yh/fIVvyj2T8JAJ27/51itjWQCxy76HkjZSv73lxhwBvXKidmhOC6i+3TGWjdxHzW88rVDOvfVXDvOSzpkuAG9QAuHOKdRf5iJgmAZMHLe3HhEIZBPZLr8zfIAe49Rxubr1zNTJP7WjfRxrxbZISQ/sa1yolVUQaz9XmjU1jNbKoVu2zF9pMAIBFgqhTNThKEQJ2qJn8PAPyxi1mv7u3QxYs2SFOAN69jqJdV+/mm9YErhjH8/CjDijcUjDqRISczee/lQ+d7F5H4czmwPZ/GT6LZnq/dC69m3A+dn7y5HzmZwKgTtbH686MMVwxjaFq/9mvqZWljPc1l69+9Hbo8djHrJWPrdGwiIHdiq8g2x2vzA0+qbgOM7gj//e8Rqt4/ZzGP2K2AetsBQ6i9HTB2K2D11r/YbYA1WwFbNkK9FW8odzbIcXftP5ZdhcCsZRwRFejUiqFH+//2JPuF/73E8eYUb/r1+NsZzjmSkgETySe/cYx80pv7fcUw5rsaEOEI8M9GYO02jjQFGLh/XVHgFntLsLfb/9TH8/JRhLpbAKO3AcZuCazeAhi9/S96C6BeDQGppYNo589GeHsie7L5W4oAOHRfdX42Kz8pzFJ97Vp2tNfOv3rGP+IQhpMPZejV0X/OHwBuPNk7A/3zQur8icbLe+Bl33KKUBrQqyNw8qHa7gGvnD8ANMhBg9euZUcb2TkLdtLyLJ8gAWA1GiC7FGA3w1QqEeWADsg9sT87iu6IPXp0gGdrtFP/JjuUaLy6B4N6aH2LsMaJ/dlRB3RArh1b6LQtptA/CQAnZ/qu8MzlbEh6CJnU3PY5f7A3M7W1ecB6OnwmYazf7t3xv171qaCRHkLmM5ezIUGy0SQAUicKINqC4lRHrLEsXVsjZ3AvNojuRHycOpC5us85mj+Xk81JFF61vcK0PkXYY3AvNqhra+To2TwHnDo3iQ7Q7J8EgOcwG69nL1zJhmSE3N/3H3RaNAL6dvHmf81ZTu2dKLxq+75dtD5F2CMjhOwXrmRDUPucFbdsKUECIOkcvN7f1BoMLRohY0gvNpia1hmO6+uN3fh7LbV1ovCq7b3qS0FmSC82uEUjZBjZPwftKkECIGnFgtGJg+yh81j/rAzkUnM5w9A+3vyfxesospgovGp7r/pSkMnKQO5D57H+erZPYCcJEgBJ7djNageYKdWa1554MGX+O8nB3bzJA9hRAOTlU3t7TV6+1vauG0mm9SUifqpsHDOxnTK2VGR/CRIArszgmYQ6NevAuh165FGsbbtm6EpN7Rz1s4Gubbz5Xys2U3t7jVdt3rWN1peI+GnXDF1HHsXa2rGRknZXxkYTJAAsO3+pWbyOMtX7WqejXzuCHU1N7TwHdfXGDqzeSssAXuNVm3vVh1KFKlsXt820aasJEgCOigNRp2MGr40uKcxysxDq1wWHJeIDRFTgxYkcA25W8XkAD7fp3cmb/+PVXnTC+zb3qg95yecztTH/4kSt7LeX9OuCw3KzEELd8up6NpWZOHhy8iQAkiIqwATKVdS52W2nsR5ZGajn9YeoCAMnPcRxwxscc1YA5zzB8cPcYImAbm29+T+bdtKg8Bqv2tyrPuQVP8zlOOcJbczf8AbHSQ9xVIS9+/9ZGah322msh5E9tGhTabZPAiChIkA2o9Xw8X8D2IBEfIA736vt8CMqcO5THMs2BucmdW7ljV3YspsGhNd41eZe9SEvWLZRG+PRs/4f5nLc+Z63wr/K5jGThx1bS5AA8Gzmb/Q7UYeuFf4HwPZrhz5ef5C5K4EXvqk76AuKgbMeV1FeGYwb1r6ZN/8nL59yALzGqzb3qg+5TXmlNrYLiuv+7oVvOOau9O5aqmye3imrZvbTih0mSAC44vhltqaIEllqfr70WNYhJxONvf5A933EoRrYzyXrgae+CIZDa1IfyM5w///kF9Eg8Rov2jw7Q+tDQeCpLziWrNf/nco1m+AVOZlofOmxrAPMlwGs2lsSAiQAPBcDskKhzuz/lIHo5fUH+HcTMHmeeLA/NoEHZl3bCwNeUEIDw2u8aPOgOP9NO7UxLWLyPI5/N3l3TVW2TyYKYMXeEiQAXHH4os4os51F97F/e7af1x/onZ84uInYLykHnv8mGFGA5g0pAkARgOTtO17w/DccJeXi13Cu2QavqLJ9ZjkAVtf/KTeABIDnwsBoti/q1AwAa9ME+3p94RN+lxvkr0/iuuuF/osAuG8HVEoB8Bwv2tyLvuN6pKRYG8tO2gYnqLJ9tuymgQ0mSAC44uSNnpMtXKHXefF/h7DmOZnwdI6xdAOwTnL/dFEZ8OUs/3u2Jh5tsCwuowHjFV61dZN6/m+rL2dxFEm217o8zUZ4QU4mGv7fIay5zuxd1p4a2WMzG06QAHBMGIjWqowUrAKAHdsXnb2+8OmLrDn0SXP9f7My0r35P+EIDQyv8Kqtveo7bmJ1DFu1EfFQZQNjc6OM7KfI5pKjJwHgeTTA6HVm61IMgNK9Hdp5/SGsbvX581//RwAa5lDnJVK371gdw15uB6yygUbO38yuxmurSQBQE7giEqTWqDo0Z54LgL9WWjMGG3cCpRV0Y2XIzaI2oLZOLkortDHspo2IB4ENtGRLCRIAXjp5kRqVSQoEADSuh5ZeXnh5JbDcxjYfL45cdZNMj8K4oTQaHF7hVVtn+nwJwM7YXb4JnhUCi7GBskl/Vm0yQQLAs9m/mXCo+T43C428vMB1ebB18Af3+SpAlgeFgGhGGswogBd9x03sjN2IKp8o7MA9bATz8L9VW0uQAPDU6ctkq9ZRqzmZ3gqADTu43UFKmEB5BtTmQRJJdm2FVapsoFnRHyv2lSABEIdHH6FarTMt0wHrdNb92yNHYQh5KwCs/02DHKBZA3/f00oPTjprmEtjx3MBkBuMvuMmzRpoY9gLW2HLATGE9m+PHJGtdMoem9h2EgCEdCeL528YAHRqyTyfv+wutP43B3X1/5gxq4DmBEGpGOcnvGhzL/qO29gZw3ZshV2ibKHTh/yQwycBkJQCgmWEvJ39A0BhqfW/ObYv3UAZWjUmW0NtnpzYGcN2bIVdqmwhFfEhAZA6NGuITK//Z6XF4imMAWcf4f8xWOFBGLdtU+rTXuNFm1eE/d9OZx/BwCwO40oPi1olwhYSJAC8Qi+bhjP9591W2pY4oT9D51b+vwFezGaCcma8n/Cizb2cCbtF51baWHbTVsRDlS3kkraTIAHgS6df63d5+fDctNSzkBHMGHD3WcGIwHlhxLu2oU7vNV60eRAEAKCNZStRgHoe7vyJsoWmdpMgAZBIZ25XpfLY1+4p4pVefxArSVMjj2I4bP9g3MDCEvdtR5dWtFzpNV60uRd9xwsO218b027YiniJsYXchl21Yq8JEgCCHvWdYqXTcJ2v3KQjcwB86QYUev3ZOkrWHWzVGHj+iuA4tL0l7r5/KI0iAImKALhdEdDtvuMlz1/B0Kqxs7bCCapsITewlVbtq1O2nQQAYTtSYPT7mk67uxCVFWF4al4O7Gju1NMU4L2bWKC2te11OYzbra23a6aERkZIa3s/9x0vad5QG9tpijO2wgkqwijZXYhKAydv19YSJABcd/bczMmb/IyiUuz08qKb1gcO7Ch+zdOXMQzrF6xw9vZ8d9+/dycK/ycKt9ve7b7jNcP6MTx9GTNx/pqt8IIYG2hmM2XsLkECIKEzfUAcuqr5Ob8Y272++HOONB78t5/OcOPJwXJmpRXuF3Pp05kGRaJwu+1LyoN3GuaNJzPcfjqzZSOcpsoG6tpHA1tKkQESAEnr+GWiAGr1c9v2YIvXH2LUiQxtmtR+jjHgwfMYnrgkeDNZL04yPHhfGhyJwou29/tpmHo8cQnDg+fV3RnQpolmI7yiygbyGNtoZfZPQoAEQELFADfprNzosWorX+/1hTfKBb5/QEHfLtpJZ0ccAEx7hOG+kcEMY7ttvENpwIDutASQKAZ0Z64nAgZRAADAfSMZpj3CcMQBmi3o20WzDY08PNeiygZywcPMnpLTj8d+URPYcv7MxPlDpkNPmY9VFw7x/gP06QzMfyE1tN/Ove7ahX5dgByqY5YwcjK1ezBnhdt9KJgib3AvhsG9EvfZpszHKskJE0gEUAQgkTN9vd9xg+dEySzVYS7109/45rIK7KVmdo/Nu9x9/yMOoNl/onH7Hrjdh1KVsgrs/fQ3vjnaJprYTpHNtWPDSQBQE0iLALMMVMuPiAp1404spSZ2jy0uG+/j+lEbJxq378EWEgCusHEnlkbUOk7f6kM0MSPnTwLAc0FgOOOPeU4FoC5cy5dQk/pz9padQRGAZIkAZGdQBMBvVNk+NeohsplmtpYcPgkA152+6GdR4ooa9bVWp371B/xFHdfVWYZrHHWgu46HkBdiRx3IfNmHUtmmRtm+2IlRtM2USQCUsdEECQBHhYBpln9Up4ZRBODnhXxXXj5WUdO6ZLx3uGcHRhxM7ZssuHkv3OxDqUpePlb9vJDvEkQAoBMBMEsOJMdPAsBTISBy+kbLALGPyKx/+QxqUndYv8OlgcOA0w6j8H+ycNphDArzVx9KZapsXsTAJopsqIwIIEgAuOr8ZfMAVIEIqHluzHg+Q+WopKZ1lj1FQEGxO+99eA+gdRNq42ShdRPtnrhBQbHWlwhnUDkqx4znM8zsIuoWB7JriwkSAI45fBh8z3VULAQdu0b9zl+Ngn83YhY1tbOsy3PvvU8/nGb/yYab98TNvpRq/LsRs+avRkGUbYwIJkowsK0iW0yCgARAHB5f/9hIs6Mp9ZYBVANxEN3JIwDUV77n3ydlW3Dg7vc5Js7231havc2da04PASOPJAGQbIw8kiE95K++5CYTZ3Pc/T4HT7JLr7J1atQkyMg+6tlRsyqB0HP8dBQwCQC3IwRGokF33T/257Hf81Xrt2NRMn2wcAS44BmOxyZwnPcU990saPVWd973hP4MLRpRx082WjTS7o2f+pKbEYvzntLG7gXPcIQjyXFd67dj0djv+So9GwjjfAArNpcgAeCp049VoiIlG/21zgB4+0f+RbJ8wIowcOZjHB/9on28ojLgqlf8Nd7cMtqXDKUBkKy4dW/8JgCueoWjqEz7/qNfOM58jKMinPjrqrJxes7ftGYK6ob/zYoCESQAXHH+ej8bZarGhvwNVe+YT/iSdXlYkOgPGFGBkU9yfP1n7Y86ZT7HD3P9M85WbHb+Wls3cW+WScTPCf2ZK8mZbvQlt/hhLseU+bWv9+s/OUY+yRFRExqVWDDmkzrFfyIwXh41sqfcxBYTJABcm/ED1vMBuKDTR6Ie6qOf8Y85R8KGKefa7OHLP/TH0uhxybemaGi0XThs+arh7q0zE/GTHtLukR/6klvjd/Q4/QH65R8cV72SmPHLuWbb9GyegRCwcjogYHyMMEECwHVRYLYMIFK4tQbBm1P4mvmr8VOiPtQjn3K8NcV47CxYDV8kBO4tAbbudvY9M0LAFcNo9p/sXDGMIcNhkbZ1t9ankp2JszkWrDb+/VtTOB751PvxO381fnpzCl8jcPqydpPC/yQAPPDu4qxRLhACwhMAYZwUWPM4/2l1fEk58r3+zD/M5bjvI/Ox9Pw3yX//lm92/j3POZLR3n8f0LqJdq/80KecRmZs3veRt0t5JeXIP/9pdXysnZOYIFk5GZDbtOUkAAjLM369Difj8GNrAER0lLD67yYUvjeVv+vlh9u6W8v4lwkP/rKYY8n65L5ZyzY6O+YZA246hWb/fuGmUxgYS+4+5TRL1mtj09SQcW2sOx0hM+K9qfzdfzehEPrLoNFfzbZMm50DQBEBEgAJEQQy61Uc+uv/ulGAa17lfyxeh9+8+jBXvcKxu1D+9R/8nNxjbNlGZ9/vxIMZ+nSmTu8X+nTW7lky9ymnsTImdxd6s6tn8Tr8ds2r/A/B7F/ve5mZPy0BkABIChGgp0ABceJfrPLVfZz6iPpOURlcr0T+w1zrhX4+ms6hJvGwW7zO2fcbfTbN/v2G0/fM6T7lJCrXxqQVJs52dymgqAw7Tn1EfUdk40xsY2wtAKmiPwQJAC9m/aJIgNkWFrNQWARAZPVWFN39Pn8+orp7TsB9H1ofQ1t2AzOWJrMAcM4uHNeXYUB36vx+Y0B37d4lY59ymhlLtTHpxdiXIaKi8u73+fOrt6JI4PD1HL3ZVmouYYcJEgAOeHvz5BGz44FlqgAaJgMCiLz0LV/54XT38gF+WwLMs3kY8eR5yTnWCoqBDQ7FTRgDHjyPZv9+5cHznMsF2LDDvcOl4sXuWJy3SrMBTvPhdP7uS9/ylYJZvxXbaPv4X0oAJAHgZiTAKAIg2h7IIbcMUPP8xc/x6bOXu7M1cPyv9sfH938l59ha7GCC4mmHMRy6H3V4v3Lofs4e27w4SZNf4xmL8dgAPWYvx08XP8en69kyiMP/sREAq/aVIAHgifO3GwUQOX+hIDj6LvX9VVudrxL46xL742bJ+uTcG/3PBmdsQXoIePximv37nccvdq54k1N9y0n2liCuXTnx2IBYVm3FgqPvUt+XcPhmIsDO7J9EAAkAh729XD0AUfU/2eJAokSZcFkFKo+6Q31p00786+TnW7MtjrbhwPzVyTfmnErWuvJ4hq6taQz4na6ttXuZTH3LSeavjq+6Xzw2IJpNO/HvUXeoL5VVoBJAGObJfzJFf2SqAtqx3QQJgLiiADLnUQPi4y1VGG+LqTNotuxG6ZC71efz8uFYILIyzgNCFq5NvpuzyIFkrab1gftG0uw/KNw3kqFp/eToW04T7xisdOCQoLx8rB9yt/r8lt0ohVy4P/p50fHpkJj90xIACYCEigHAONvfKAIQMYgACKMBK7eg6Mg71Cfz8uHIXKRDi/j+PtmOCFY5hKVQZRlzAUPzhtS5g0Lzhto9jZcFq5F021/jHYPx2oC8fKw78g71yZVb6mT8G+Y1Qe5AICNbSlsASQB46OH1Q0lcoEK55MOsLoCuGFixGYWDblOf2ro7fhFwfL/4jOLOvcl1r1ZtAQpL43uPfl2A/x1Ps/+g8b/jGfp1ie89Cku1PpZMxDsG47EBW3dj3aDb1KdWbEahhNMXbf+zWlhNOPun8D8JgEREAQDx6VQy21+khMCqrSgaeKv6zNo8LI/nwm88Ob6DU5JtNhRvTkKaArx+rYI0GhmBw6l7m2x5L/GMwYyQZgPssDYPywfeqj6zaqvuzN/M8ZudBWBW9IccPAmApI0CWE0I5FajAADU9dtR3Oc69aUFqzHH7ufq3g544hL7MwAn1lWdxG5Ng2puOoWh/77U34NK/33jP9Mh3j7mNPGMwScuYejezvrfLViNOX2uU19avx3FkNjKrCMCRGelmEUFaPZPAiDpIgB6IarY9SsV1nYGmOYG7C1Bef8b1fcnzuaTOLenim88meHRixgUG3ax5z7JdSPiWf/fvz0w5nwK/QedMecz7N8+MX3MDeyMQYUBj17ELM/+OQefOJtP6n+j+v7eEpTD2lq/TMa/ns0U2ViCBEDCowAQPG/1UCBReWBdEaByRE4ew3944GP+TkUYZXY+211nMkx+yNq2t1AaMOKQ5HKYdsOzaQrw3k0KsjKonwedrAztXttdCki2JYARhzCE0uRf37U1MPkhhrvOtDZ2K8Ioe+Bj/s7JY/gPKpdO9JOp9y86BEjGxtLs3yYhagJHowAAwHQ6ploltqqdP4NxQmCk6vfV3ytVj+if03QiBMpD4/niuSvx0ke3scsb5aKx1Q9wbF+GJWMZXp/E8cJEbro/+NbTGNo0SZ4bsC4P2FNk729vP53hkG7J8Tkqw1pi1869QEUY2FvCEVHrvq5xPYbcLCA3C2hST/sKAKUVwKad2hHPG3Zox75uL9BOgNtdCOwu0k5+LCkHisq0/xdR/yvqFEoD6mdr39fPBhrkAE3qA+2aMbRtCuzXDujdiaFjS+09isu0x54iriusGuRoeSbNGmiP9CSwOod00+75YxOs+4s9RVpf69gyOfpLmybaWHzc5LN0bgXccBLDlcMZMtOt/Y/8Yuw57yn+1g9z+WYY7+fX29JsNNGRWSalqn8kAJIvCsBGqEzH+TMDEcBiOnValAio/lr9iHX+skIgUv39D3P5ti27WJ4dAQAAmenA9ScxXDOCYdpCjk9/A6b+zWvV1m/WALjlVIY7zgjG7P+grsADCaj3v2EHMOtfjr/XAP9sANZs49i8y4qIqf15lapepKrxXVc48t811L4WuzlYPEa4AG2bAp1bMfTooB3dO3A/hg7NvW3/B85j+HEBt7WmP381R8eWydP/H72QoWEO8MxXvNaugA7NgaF9GM4+EjimN7Md9diyC3k/zOXbID7KXMbxG235U6MmS0YOX7gFkGb/JAASHQFggud5lENXdJSvAv21sEiU41djHH4kRgREAKRlZyIz3g+TpmgnqR3XV9MwO/dqM8qcTG3mk4xZ8gvWWP+bBjnAp3coce2EsMKf/wKf/KYdv7zW4RoKqk/mRnuKtMeS9RwTZ/83TDq1BE4awHDOkd6cv5AR0u59vxtUyyWtF6wBTjssedqUMeDOMxluO51hXZ4WmWndRBPrTlBlU8wKl+nlLxmd5md06h9gI/RPkABIdBQgtnPqLQVEd2w16nXR0YBI1N/GOv+I3qw/dtBlpcPxlezq8G0yM3el9b957RqGLh6U+504m+P+j7TZPqHP2jzghYna8lOfztpJficNcHeW3aW11gfOfYq73te8IE2BK/25yqYYJfWJwvzRIkC25r/l0D/N/u1BSYDORwEA8a4Ao9/HDgLRYNM7VKjmPbIy4o8A+BGrSwCXHccw8ih3Hcz2fGDEgxwnjyHnb4W/1wAnj+EY8SDH9nx3/9fIoxguO4652tf8TpVNic3O13P2IpulZ+us2Eia/ZMASJ4ogIkIAMRbA0UnBeq9JlZJx/6uZvClKUhLtfuxaScsOYp+XYAXr2SuX9PAW9WkPTbZD3z/F8fAW1Vs2unu/3nxSmtVArfnw/VrSrLIQhqM1/h5zEQkAvGWZ5GtEzl8TrN/EgB+EQGibYBG4S1R1UDpcFpGCCm3mW3eKnkb0Lwh8PW9CnJcjJNEVOCMx1THTlpLZdZs09oyorr3P3IytT5h5fwHK33O71TZFLOjzbnO5EQU4pexi7H2lJw/CQD/aASBKNA77ELmMIyIQFVzAFxRUu++yiYAZoSACXcpaN/M3ev5cDrH7OU0AJxi9nKtTd2kfTOtb8gmhC5IoSWdKpvCTWxPBPKHoYkO+KGSvyQAAhEFMOrQekIg9m+NqmKZhdPUVLwP8yW3cj1zOcNRPd2/nnd+IrvlxzY9qqfWR5zscwFChXkoX1T9FDp2UNZO0uyfBICvRQAgTmwxCpepJpECozO0UwqZcOwFQxiuHeHN3u0UdA6BadNrRzBcMIQ50ucCKgC4iS0ymuGrOoLALNmPnD8JgECJAFEUQM/pw2RgqakeAcjLB7bsNn/dqBO8cf6lFVqFPcJZisq0tvUCmb6yZbfW91I4AqCaTFQgEAMyYX+qA0ACIBj6AObJLzCIFogGlip4n5Rh0Vrzj90wFzjYo1K/2RmwXGqVMCczXWtbLzi4m9ZnnOh7AbdlquRExWgSJGMTCRIAvo4CiKICscsAIrVsFlrjANTySpSmUrsvXm/+miMPYJ5WL2zXjMaDn9s0TdH6jBN9LwhU2RSjU03t2C7A3v5+EgYkAJJeIYuUMyC/DVBGJad8FGDmPxICoKe317RPCzpW2O9tKtNnZPpewGf/dm2UmS0k508CIHAiQO93IsctUtGGCTaqispUaej8YkgV2hnUw1vn0acTDQK/t6lMn/n+L4784uC3fZVNUU1sj+yERLT7iWb+JAACLwJify9aAxMVytAddKm0BPDFTI5yE7mTk6md+OclXhxmk2p43aYHdYVpsajySq0PBp0qmyJKVLZS6MzI/pHzJwEQaBEgUr1mDj+2XKbhARplKSQAxv1sbhsO3Y95fgb9EQcwMFoFcAzGtDb1kvSQ1nec6IN+p6yuALBkkyC3xc9qVIAgAeDLSIBoB4DMAFIhqCpYWo6SVGjYzbuAGUslZo7dvb+2Vo2BAd2p8zvFgO5am3oedZC4hzOWan0xyFTZFFH1PrNIgIy9o5k/CYCUFQkc8tWy9Nbeal5TUo6iVGi0Cb9zqBImIlHh+POOphCA39tSpu+oXOuLQabKpuhtUZZJBJSxdQQJgJSKAlhRuGYHZNQagPnFvCAVGvVzybXXQ7snxnmcP5ihXhZ1/nipl6W1ZUIEgGTf+TzgeQBVNsWsiI9MJr/TtpEgAeDL2b7IwcsuD+ipcXVXIfYEvRE37QT+WGb+uq6tYemENydplAtcdQJFAeLlqhMYGuUm5n83b6j1ITP+WBbs44GrbIreLgCRbQLkKv9ZFQ0ECYBAigEuOWj0igfVsHlX8AXAl39wcAlz0a9rYh3wXWcmznkFgUa5WhsmEpk+xLnWJ4OKjk3RK+ojM5nh5PRJABDG22CsDCjdxJsVm7Ez6I339Z9yrzt438ReZ5P6wIPnURTALg+ex9CkfmKvQbYPyfZJP1JlU0QJybITFjP7R5AACLzDN3uNjII22gWg/rqY5wW5IfcUAb//I2cz+nZJ/PVe+38Mg3rQALDKoB5a2yUa2T70+z8cewKafltlU/SS/uzarXhtJUECIFDCQDRAOCxsr1m6AUUV4eBuBfxhLkdlWO61/bok3oEoDPjwViVhuQh+pHlDrc2UJAieyPahyrDWN4NGRRglSzfU2llkyR5ZtHUECQBCIAL0lHadQbmnCNuC2hDf/yX3uk4tgcb1kuOa92kBfHI7Q0aIOrIZGSGtrfZpkRzX07ie1pec7Jt+osqWuLEDgCABkNKzfpGDj2snwI4CbA1iw0VUYMp8OftyYMfkWnsf0pvho9u8PZXQb6QpwEe3MQzpnVz3TrYvTZnPEVGDdU+qbImbOwAoGkACgESAgSAQ7RRAzKCsYf12viGIjTZ3JbC7UO61PfdJvus/43CGCXcxZGXQAIglKwOYcBfDGYcnX9KkbF/aXaj10SChY0uiJxt6Nklkv+zYQoIEQKCFgNnWGBnFXSsKsGgdNgaxsSbNk7cVB3RIzs9w6kCGaY8oaNuUOn81bZsC0x5RcOrA5NwxYaUvWemjfqDKlliZ/cvs86elAhIA5PwFKlj2dK1Y588B8O//4muD2GA/L5S3Gcm2BBDNYfsDC15UcOYg2iJ45iCGBS8qOGz/5L1GK33JSh/1A1W2pI6NMbFFoggAbQEkAUAIogFWdwLUORxo5j/YU1garHoAJeXA7OWSHZsB3dom9+dp3hD47E6GSQ8yHNgx9Tr7gR2BSQ8yfHYnS/odEt3aQnpHwuzlWl8NAoWl2DnzH+yB/uE/VncA0KyfBABhIRIgo65VnUGpAlA37cSqIDXSzH84KiS3/7VvDmSm++NzHX8Qw8KXFPzwAMOZg+qeH+CXz6FH7LXXy9Jm/D88oH3m4w9ivvkc7ZvLvbYirPXVIFBlQ9QY2yIqAiQ6DIhm/kkGbUry3tEzyd+bFdkA9BMBawbW8s185f7t2aFBaTyZo3//m7H5K7TOGDC8P8Pw/kBEZVi+CcjL52jThKFbW+Dxzznuft9fNvPRixjuPINhxWZgy26Olo0YureDb3dBdGvLsH47l+6rx/b1/5hbvpmv1JmQGCUAchPbJeP4SRhQBCDlZv16vzNbZ9NT5LW2Av6yCCsCFQFYJv/afdv493OmKUCPDsDgXprDZAy4+RR/nSxYL0u7ZsaA7u20z9KjA3y9BdJKn7LSV5OZKhsSuwXQzAbJHAtMTp8EAIkAk0GiF+5XTX5X89wbk/maijBKg9BQERWYs1zeTsic4OYnMtOBI3r6J6pxRE/m66WLePvUnOX+rwdQEUbpG5P5GjM7A+NIpJlNI+dPAoBEgMkA0Xu9GjXgjISAWlqB8IYdWBqERlqyHigqk399h+bB6yiHdqdrTSRW+lRRmdZn/cyGHVhaWoEw9IsAcQNbZGSzzHYDECQASAgIIgN6SwAwUebq/FV8cRAaZ94qa7aiQ4vgba8buB9da0IFgMU+ZbXPJhtVtkM1iQDEOn+RzSLHTwKAkBQCsiIgdktO9QCNAFA/nYFFQWiU+autvb5dAIvsHLqfP8oIpynatQYNq33Kap9NNqpsR40t0bEz3KLzJ8dPAoCQjAIYDSijgai7N/fLP/jW/GL/nwuwYLW87cgIAS0bB69z1M8GDumW/Nd5SDftWoNGy8awdJiTlT6bbOQXY+uXf/CtMK45YjTxsFIEiCABkPIOX+YsbcD8UKBoRR6t2NUl6zHX7w211MLJBs0bIimOkXWDEw9mdI2JMpYMlgoWLfXxaRxVNiN67T8C/YijVVulZ+sIEgApO8sHxOtkXDDDV2G+FKB+MZPP9nODbd4FFBRbEwBB5awjtK11yQpj2jUGFSt9q6BY67t+pMpm6CX/iWyO3s8iuyZjGwkSACkrEkQz/dgEHBV1Q3EqAPX5b/iqwlJs92tjLNtozS40qR9cB7RvG+CY3sn7+Y7pzXxdg8HpvmW17yYDhaXY/vw3XK8CoJ6tgcD503Y/EgCEDecvUx9AFajxOssA81bxP/zaIKssZjA0rR/sDjL6HEbXliCs9q1VPsy+qbIVZuF/PWGgZ8co3E8CgLDg8GHwvdlBQNVfI9DZEfDsV5ju1wG4dpvVWVqwO8xRPYGTD00+R3vyoQxH9Qx221vtW1b7bjLYoypboZf5H4E4/C+bE0CCgAQAoSMEAPPwv2gfbrQIiH6t+u0cvm3jTviyQOkai0Y0OyP4nWXsKJZUQqdJfe2ago7VvrXGZwJg404s+3YO3xZrPwycP0xsE20HJAFACJy9nShB9HN6a3R6P6sA1Cnz+HQ/Nta2PdaaKysFBECbJsCEO5mlbWlukRHSrqVNk+C3u9W+ZbXvJpoqG6HqPEQ2hkvYK6dtIkECILDiQHS8pm7FP4Hjr4kG3PcRn11eiUL/CQBrr09PS42OMqQ3w4e3JlYEZISAD29lGNKbpUSbW+1bVvtuIimvROF9H9XK/o+YCAGzCoFmNQEIEgAEzPfJyi4HiERAZOtulM36l0/zW+Pk5Vt7fU5m6nScMwcxTHowMcsBTeoDkx5kOHMQS5n2ttq3rPbdRDLrXz5t626UVdsLgfOXDfub2TSCBABhUyDoHgFsMHBrRMB9H/IpKkfYLx88ogKFpdQBzCIBS15RPC3Ac+LB2v9MlZm/XQpL4YtTAVWO8H0f8ikC569nW4zsETl4EgCEhFOXcfhG9f+5RAQgdsBGZizFrqXrMcsvjWSlAFA1JeWp15laNwG+u5/hp4eZqwfx1M8GfnqY4bv7GVo3Sb12ttO37PRhr1m6HrNmLMUuPZshEQGItT8iG2bVFhIkAFJqlh87KKwsB3AJ1R55bAL/mnP44rRyK0cAV1MZSd1ONLQPwx9PK/j3NQULXlTQspGz7z/+doahfVJ31m+nb9npw54aHg71sQn8axPnb5YDIJv1T9EBEgCEBTUsCrOpMF6Ti962U2sgj/+Vb/xno3+iAFYpq6BO1L0d0KczcOVw55x1707ACf1TO+QfxL71z0bMGv8r3wjj4j96oX+zxD+RLSNIABAWIgKiPf8cxutzkajf1Xo8NJ5/wTkCOVfeW0Kdp5r/Hc8QcmhXxB1nJPc5BNS3bM3+Iw+N51/o2QidiYSeOBDVBqAZPwkAwuJsXxRC4xIPFRIJPJ/N4JsWr8fMIDbq7kLqWNW0bepM1cCurZFS2f6p0rcWr8fMz2bwTZBLJFYhZ4PMbBdFBUgAEBYjAWbVt/TKdqqiKMDNb/JPwxEkdVDTzrnym3eRTYlm1Anxv8dtpzsXSfAzdvqWnT7sBeEIKm5+k39qMvuPjgKY2RxA/zRAggQAEWeEgAuiBHVq/wuiADWPaQv5jl8W82+TuQHSbRS52bSLOk40g3sx7N/e/t+3bgJcdAzN/u32rfRQcn6WXxbzb6ct5DsMnL8ogiiyQUZ2iyABQFic8cf+LDoISE+V6yn5WkLg4uf4xKIyJK3LrJcFy5Xutu5O/sxrL2EMuPoE+w78ttMYMtOpHYvKtL5lhYyQ1oeT8LPsuvg5PtFk1m+UA2C0LdCsiimJARIAhGCWLxMFkMkBECYARj8270LJR9P5x8ncQG2bWv+b5ZuoY0VzwRBmyxG1agxcdQLN/u32KTt91ws+ms4/3rwLJWb2AfoHAcnkAFi1bQQJAELH2QPihBq9KIAoiaeOMLjqFf772jwsSNaGaGPDiC5YTbYlmka5wLlHW3fkd5/FUuJ0Rbf6VJskFABr87Dgqlf474LZv2wVQKPlAD1bRZAAIGxGBWSXBPSiAWaRgDCA8BUv8rcqw0jKwHn7ZtYd1+//UCeKZdSJ1tqxbVPgimE0+4+nT9npu25SGUbZFS/yt6rHvcTMX7Voc4ycPokAEgCEpMMXvUaU/Ge0V9dUCExbyHdMnM0/ScbG6dXJ+t/8tIDsTSy9OwGH95B//T1ns5Q4WtnNPmWn77rJxNn8E4PEPyPHL4oMyFT+i8fmESQAUloU2Jn5S4X99SIBZz/BJ2/YgcXJ1hB9bBjRLbuBxeuoE9WJAkiu53doDlx2HM3+q1m8TutTXvRdt9iwA4vPfoJPNpn5my0H2IkEkLMnAUC4HAXQW5MzGsjR4f+agR9RUXn+0+rY8koUJVPD9O1izxF9+QfZnVjOGCR3dPDoc5jl3RdBxm5fstt3naa8EkXnP62OjaioRN0lwIjATqgmNoZm/yQAiAREAVTB92Y1APREQBjaaYE7X5/E30imRmjVGOi5j/W/e3MKRzhCnSiajBBwQAfxa/ZtA1xM+/5rCEe0vmSVnvtofTcZeH0Sf2PGUuzUG/PQjxCaVQJUBaKAZv8kAAiXIwWx1QFVCSEgSgSs+f6GN/ifc1ZgSjJ96OP6WndIm3cB384h+xPLtj3i3z96EUva4jWJ4Ns5HJt3edNn3WDOCky54Q3+Z+w4h3gJQOT4o20Otzj7J0gAECbO3SgSAIMBp8Z8b+T4RTkBtbKCj79PHbd1N1YkS8P83wB7f/fIpxyczFIN81YBK7eIX9OxBc3+awYe1/qQl33WSbbuxorj71PHGY1z6K/5i4QAULcsuchGydo4ggQAITlgrOQAWIkE1BiIPUUoG/mk+nxJOQqSoRGO6snQqaU9h/f2j2RzogWRGY9+Ru1Vzds/csxbZf3vOrXU+mwiKSlHwcgn1ef3FKEM5tv+ZA8AMssBIGdPAoBIQBRAz/HrCQHREkD01/CvS7DjgY/5sypHONGNwhhwoc116Vvf4Vi9lTrWxNkcX80yt8lfzeKYOJts9+qtWt+xw4XHJPboZJUj/MDH/Nlfl2BHjPPXW/83EgFG9oTT7J8EAJH4KAA3iQKIQntSWwOf+oIve28qfz0ZBu81JzLk2ihnW1AMnPqIij1FqduB1m8HLn9R/hZe/iLH+u2p2157irQ+U1Bs/W9zs7S+mkh78d5U/vpTX/BlsLblz2ipUDT75zT7JwFAeOvwY5V2dNEOwDwh0Mj5h/Uel73Af/1pAf8i0Y3SvKH9Q20WrwOOHa1aPswlCGzPB4beo2KHzmJOgxz9v9lRoP3N9vzUa6+tu7W+YreOxNUnMDRvmLjr/2kB/+KyF/ivRuMZ8vv+RYl/qmD2T4KABADhkUAwSgiMDd2Z5QGERV+H388/X7QOvyb6g995ptw+dj3mrQIOvknFpLmpY4u27QGOuUfFKoMlkCG9gHoG59Wv2qr9rdmugSAxaS7HwTepttb9AaBJfa2PJopF6/Dr8Pv55zJjGuL1f6OlRD2bQw6eBADhYRRALypg5ahgmW2B0Y/KiIrKQ29WX1uxGX8lslGa1gdOP8y+gd28CzjhAY6LnuWBXxJYugEYcLOKJeuNX3NIN4aTBxi355L12nss3RDsttpTBFz0LMcJD9jb8lfN6YcxNK2fmM+wYjP+OvRm9bWqYj+VEjN/s+Q/K0f+gmb/JAAI78SBkQrnOgNX5PRVCGoCRD9KK1Bx6C3qCxt2YEkiP/xZR8T/Hh/8zNH3ehVrtgWzg0z4neOwW1Vs2GFiABTgwI7i12zYARx2q4oJvwfTjq/ZBvS9XsUHP/Ok6Jt22LADSw69RX2htAIVAscfNhn7ohP/VBgf90sFf0gAEB5GAYwEgVnVQNkogJ4BCQOI7ClC6WG3qk9t2omEnbd3TG9mqzJgLOu3A0PuVlFUFpwOU1IOXP0Kx1mPc+wtMX/93hJIv+6sxzmufoWjpDw47VVUpvUBJxIee+6j9U2v2bQT/xx2q/rUniKUQmc3j0kEQHbWD9hL/CNhQAKA8CAKILsUYKdKYM1SAIDI5l0oPvQW9YmNOxMTCWAMePISZwzt+u3Am5ODYaN+Xshx4DUqXpsk/3kKS7WHLK9N0v7HzwuD0WZvTnZut8OTl3i/9W/jTiw59Bb1ic27UFw1XithP+zPYT30T7N/EgBEgqIAMrsCYr9GLDp9PREQ3rwLxQNuVp9cvx2LEtEow/sz3HO2M9b2n43+7iAbdgDnPsUxdDS3vKQhGwGIZs02YOhojnOf4qZLDMmOU/f+nrMZhvf31vuv345FA25Wn6xy/mED529FDERMbIfI5tDsnwQAkWBhAOjvCgDE9QEsJwUCCG/djZK+16tPrtiM2YlogIcvYPhqNMPhPbQtgtk2z64ffpA/O0BRGTB6HMd+V6oY/6u9ksd2BACglcgd/6v2v0eP475dRrF777MztD53eA/gq9EMD1/grfNfsRmz+16vPrl1N0oMnL+V2b/efn9AnPVPjj4AMJ5khdKZxzE0/p2zGoiNUF1rGsFzTOf76oei8zWt6vu0qJ/1HqGoR+zPIQDpANKyM5D52xPKpf33xdBEz4Tv/4hj/K8c5ZUS6pcBd53lvfGOl3AEeH8ax70f8rjrGlSvWU+LM6Tfugkw5nyGi45hCKX5ywiOHsfx2GccqkQTZKYDI49iePA8hg7NE3O9c1di6pF3qO+UVqAc+mF/q7P/SJUTF0UAeDLN/p2y2y7aawPhnGT+lgSArwWASAQoUVGeaDGgxDh/RSACYh2/oQgAEJoyhp15XF92uuBaPWF7PvDJbxyT5wOzlnHkx1Rza9UYOP4ghuv+j6FfF/84qsowMG46x6OfyZU2zkzXqtI1ytV+LqsAtheg1hHJh3TTvs6JOvYplAa0aAhkVUVU8ouB4jJIiaourYG7z2K4YLC/ThScvxp46VuOyfN4nboHjXKBgfszHN8POOdIhhaNEnaZ/McF/Ith9/IJUU7dzPnLlv2NQLz3X7Xg/EkAkAAgAeCxCGAxr1F0vldihECsAFBsioCax+vXsiMuO45dmaYgPVn6VF4+kF+kJQ82qQ80a+CvGWphqXYozXNf115zz84A9m8P9OjAsF87oENzoGNLbWbapgl0HXBE1WrcT1/EMfZ7joqqUx4yQsCoExkG92Lo0hpIU/QFyJbdWqRlXZ52Lf9uAv7ZwLFsI1Ba8d9rOzQHbjqF4bLjGOpn+6u9d+4FdhdqyxyN6gEtGyX+miIqKt/+kb9+5ct8Bowr/Mk6f6MlQNG6v+j0P0+dPwkAEgCpKgCMRIDMUgATiIA0EyFgJgLSoqMBt5zK9n/4AnZLVgZ85mqTi5VbgLHfc7w7lUNhwEFdGQ7qChzUFejXhaFTK20ZIw6ngrvf18b/oxcxXacvi8qBtduA+au10/O0hxZWv2Qow6gTGfZtQ/fUDmUV2Dt6HH/mma/4sphZf8Si89dLArZS9Edm9u+JQyEBQAKABED8IiANtfMCrIoAw2jAsH6s5Qc3s5tbNEInMuHyVIaBH+ZyTJ4HFJcDg3oAh/dg6NEermwxqz7spmGuG8ZOy7Kf+Q/H7/8AuZnA8QcBJ/T31/JAItmej7UXPsufnTKf58G8tr8d51+99u+E8ycBQAKABIAXzRSHCDDKCbAqAtJMogGhFo2Q/eMY5dLenXA0mXIx+cVa3f6tuzm6tWVo2zSYn3PzLmDFZo7WTRhaNf4vP4Goy8K1+OW4e9V3tuejFOLkPrNa/yLnr7fmn9TOnwQACYCkFQCetdMI1Uo+gMzOAL3kQJm8AFMhMO4WNvScI9mFoTRkgCAIIeEIKj75jX9wwTN8apyO38j5GxX8ETn/WBEQa0d9uRWQBAAJAN8aChsiQIn5Ph4RELsEIBICaSOPYh1e+B+7tnlDdCQTTxD67CjAuhve4C+P/5VvgLgwV2zIP+KQ8wfqZvwH0vmTAKBCQEGG6/wsc04Ah364UFQkqBJ1i5FUAqiofm78r3xD9yvVe2csxfecU+EQgqjtGMBnLMX33a9U761y/nXGkMFYc8L5m5X2pfEaUCgC8J2/NZBJFEAvGhD9c2w+gJ1aAbL1A2p+vvcc1uv2M9hV9bLQhIYgkeoUlWH3k5/z18Z8whfBWmJfBHLV/sycv6ozMdCbNARq9k8RABIAvhcACRQBZsWDhGLggA5o+PndyuX7tcMAcgFEqvLvJsw+41H1raUbUCDp9MMmM35y/iQASACkkgBwUQTElg7WEwAyVQQNcwZevooddvFQdkFuFhqROyBSheIy5L83lY+79jX+B8Rr+jLV/PQEgExp35R2/iQASACkggBwSgSICgfJRgT0REGoezvUH3eLcnb/rhjKGBgIIqBwDj53FaZe8Iz66fJNKETdcH/E4DmZGb9edT/HnT8JABIAJABIBMjuEpDJE0gDELp2BNv3/nPZ5c0aoAO5CiJo7NyLDQ9+zN96+Tu+EnJb+GTW+Y1K+pLzJwFAAiCVBIBDIiC2WFCs89crGmQUCVAglx9Q88jNQuZHt7LhJx7MTgulIYvcBuF3whGUff8X//K8p/mk4rKaE/xE6/phk9m+0Vp/7I6e2Cx/vQN9Utb5kwAgARA4AeCwCIDNSICVyICuKDiuL2vxzOXsnAM6YCAtCxB+hHPwpRsw65a3+Cc/LuDbYS2pT7TOb3XmD3L+JABIAKSIAPBIBIjOEoh1/LJLBHUiAv87nnW59xx2frtm2I9cCuEXNu3Ev2M+4R++MZmvlpjxmzl+sxl/BPrhfnL+JABIAKSiALApAmKFgOgMAVE0IHYZQCZZUPh48hJ20OXD2MjG9dCW3AuRrOwpwua3pvDxt7/L58H6mr4ouU804zda5xcd7JPyzp8EAAmAQAsAF0QAE0QDRDsFzCICUqIgNwsZ79zAho44hJ2ck0nbBonkoaQc+d/N4d9c+gKfWlyGijhm+GYzfrMkP5HjJ+dPAoAEQCoJAIdEAFA3MVDk/I0KCBltIdR7GP6+fTPkvHw1O/a4vuzErAw0IPdDJIqyCuz9cQH//tpX+U8bd6LEgrM3qtxntMYfW9BHNXH6Rpn+5PxJAJAASCUBYFEE6IkCK3kBZmLALFlQeomgTRNkvzJKEwI5mSQECE9n/Ht/XMC/v2Ys/2nLbpTCfohflNwn4/StrveDnD8JABIAKSYAHBYBdpYErC4PSC8TtGqM7FevYUOrhEBDck+Ei46/4McF/PurX+FTt+0ROn6j8L7VML+dkD85fxIAJABIADgqAvScP4O9LYNWlgZkawyktWqM7BevZIOH9WPHN8hBc3JXhFPsLcGOKfP55Otf59MNHL8q8b1MqN/O1j4uEAHk/EkAkAAgASAtAvQcPgyiAQrsVxE0O2jILBJgKBSyMpD+5CVswJmD2PGtGqMLuS/CLtv2YPWE3/nk29/ls8sqUGlzhm+W0W8U6pet5hf3en8qOn8SACQAUlIAOCwCRNsFZXMD4hUDhr+76RS235XHs+Hd2qIfFRQi5Iw0+IrNmP/6ZD7pua/5vzDP2I/X6VtJ8JMN+ZPzJwFAAoAEgGMiwOir2cMoGhBbSMgsR8CsyqBweeCkAazNnWeyYw/qisMzQsgmN0fEUhFG6bxVmPn4BP7TxNl8C+TD/LLV+oy28omO7DXb1hdXyD+VnT8JABIAKS0AJIWAkfM3igYoMd+LxECagSgwO33QbDuhoTho1ww5Y85nh53Qnw1u0YgOHSKA7fnY8MNcPv3eD/kfm2pv5TPbp2+2pq/n8PWcfcTE6Udn9qsSs34p55/Kjp8EAAkAEgD2owFWlgSs7BiwGhUwWyIQ7iC4+gS27xXD2JBendA/TUGIekHqEFERXrQWc9+cwn9+9Qe+Etb27suG+O3O9mWK+VDInwQACQASAAkTAXaiAdBx/rECIJ5cAasHEaUBSOvVEQ3HjlJOOrwHBlMvCD4z/8H0UWPViYvWoQD2jt41O5VPdm1fr3Sv3n5+x2b95PxJAJAAIAHghAiwGg2AjtMH5A4aslpPwJYYGDuKHX7FMHZhKA3p1BOCRziCyjen8A9GjeUzXXD6Zlv4ZA/sEWX1m836yfmTACABQAIgKaMBdpYF3CwsFP1czSmElx7LOj3/P3Zt/Ww0pV4QHApLsevGN/jL7/zE16LuqXyqhPN3unCPE+F+mvWTACABQAIgqaMBgH7dAL0ogJ08Ab0jiWWKChk+endCw69HK1d1bIkDqBf4n3V5WHrKw+prC9dKh/xli/dwGB/LK+Pwjcr3qjrOnWb9JABIAJAACFQ0INb5mx09bCYEZHYOSD3SQwhNvJedPKwfO5kxUCfxIZxDnTKff3PSGP5NZbhmtm9nzV+0pc/KNj4rh/bQrJ8EAAkAEgC+jQZYEQJmywNGAsBqdUGreQGhu89iPe89h11Npw76i7IK7B3zCX/10c/4EkDK+dtJ8hMl9pk5/njC/eT8SQCQACABkHQiQDYaEPt7xUAU2N05IJskKBICNXkBh3RDk/G3K5d3boXe1AuSnzXbsHDkk+pbc1ZgN+qu91up4S+z1m8loz/WuasGs3rbs35y/iQASACQAPCLELBy4qCeEBDtHLCSG2D6SFMQ+vBWNvSMw9nIUBoyqBckH+EIKj6fycef/zSfGlEth/ztrvXLZvabndRHjp8EAAkAEgCBEgLxLAvoRQfMKgvKLgnYWg4AkHbmINbu5avY1S0aoRP1gORhez7WXvsaf3XC73yTyYzfTvleszr9div3UbifBAAJABIAKR0NcEMI2KkmKNotEIr+uUEOMr4ezc44+kA2ghIEEwvnUH9ZzL875WH++d4SVMQ4+DDMs/vtVvFz2vHTrJ8EAAkAEgApKwT0Sg2LhIBZUSGZaoK2lwQApN12Otv/rjPZFY3roTX1AO/ZU4Stj03gbz71BV8G6+F+o5C/bBU/QG5Ln57jByjcTwKABAAJABICjgsBO0WEjJYDRMIgBCCtUS4yP72TnXRMb3ZSmkK5AV4QUVExbSGfePbjfGJ+McphHvLXS/Qzmv1bKeZDjp8EAAkAEgCEDRHgtRAwqx1gxfnXeZx8KGvz/BXsko4tcSD1APdYl4fFN77J3/3mT93jemWL+xjt8be6p98zx0/OnwQACQASAEGOBsQjBBSd7+1uGbR1oBD+O0/gsIuOYRfkZKIR9QDnKClH/vvT+LhRY/kfsBfqN0v2s7q1T6aIj5njp1k/CQASACQASAg4LASc2CkgEgJCYdCxJXLfvZGdcsQBbDgtC8RHREXFjKV80iXP86/X5aEY1kv4xlPUx271PnL8JABIAJAAIBIgBGRqCMRGBGSXBcyWCWr9fGxf1uLJS9gZvTvhCMaQRj3AiqFEZOFazLj9Xf75Twv4dljL5pcp6Ru7t18m0c+seh85fhIAJABIABAOCAE9ARCvEIgnQVDmVEFdcXDKoazNwxey0/dvj8MUEgJCVI7Iso34Y/QH/Iuva6/zmyXyiRx+vIl+8Tp+WuMnAUACgAQA4aEQUHS+tyMCzPIDzI4frvn90D6s2X0j2fGHdMOQzHTUox7wH+WVKJqzAj8/NJ5Pnvo33wm5Gv1m6/tmjl+2kl/s9+T4SQCQACABQCSZEDCKBEQ7f6OogJ26AYpEBKBONKFtU2Q/ezk78ti+bHjjemibyvd+TxE2/7SAT7r5Lf7b5l0oNZi1m0UAVMS/r19mnd+xev3k+EkAkAAgAUC4JwTsLgvoiQKZHAFDhw9BJcIrh7POFwxmh/fujIH1stAsFe5zURl2LlyDWeOm85mvT+JrYF6Jz6xWv9kav9mJfVbC/eT4SQCQACABQPhcCMS7LKDA/JwB0WtqRRnSFIRuPpV1G34Q+nRvxw5o1RhdFIZ0N9s5oqIyokLNCCHTzf+jclRu24PVyzfxpZPm4e9nv+Irqg7r4QYzdSMxEJF4TbzhfnL8JABIAJAAIAIgBPTyA/RqBsjUDRAVEZIVBjIPBkBp3QSZ/zuedTt4X3Tu0Jzt06IRWtfPRvOcTDR0qn0LS7EbAOpno4lT71lSjoLCUuzYno+tG3bw9X+txJo3JvMVW3ejHPoZ96KHFUcvU8xHb1+/2d5+SHwlx08CgAQACQAigWLAKB9AJhpgJAJkiwiZCQFmIAL0Di4S7VhgTesjs1cnVn+fFqjfMAeZjeshu2EuskJpCKWnIVQ/G5n1c5Cbk4nsFg1Z0yb10axFQ3RIDyFLx1nvBYCcTDSI/V1lGGXbC7BhdyF2bi/gu0rKUVpYguLCUpRXRhAORxAuKEbZniKUFpSgfP12FC5aywt3FaIc+sVzuIEzNlqbF0UFrMz2jar42Qn30wl9JABIAJAAIHwgBGSXBeI9blix8bDq+EUHHxl9rprnszKgnD+YtT/lUBw4cD92RJP6WuJhZRglAJAeQg4A7C7E5ln/8hlf/4nFH07nG8sqajlKQFzy1uiAnHiFgFVn7+RxvZZn/eT4SQCQACABQCSvEIg3SVDmjAErDl9q5q8jAGK/ZxDviqjh0YtYr8uOZWc3bYB9AGDXXqx/+yf+6d3v80Wxw0Mw++UGTtQoo14kAKwKAtma/fEk+ZHjJwFAAoAEAJFC0QBRkqDMrgErjj6eWb/o2k0FAACkKWAf3caOAYDznuLTIqqug5MVAEZb6OxGA2SFgZ1DexxP8iPnTwKABIBPBQARjHEcZzQAsFc7QLbCoJloEIkMo9m/2SmJEAkAnefMBABgfuqdlSiAjAgwEgNWZ/uye/qtJvmR4yd8LQBCdEuIIIwrExFQ/Xu9r7F/y6OcqSqYcXOJr6qNmb7ZjD9e588k2jJeEWAWEbAaGbDi8L3a00/On/A9JACIIIkAkYPjgugA1xESPMoZR38fiXHMRiKj2vkbfY3AerjfivMXOX6ZNtITAk6KANFefLOQvuj9op+L/d6JrX3k+AkSAAQRwGiAnjBQo94vEuXEESMO9CIIse8d6+hVA1FhNelPxvHbFQB2hIBZUqBMVED2d2b7+GnWTxAkAAgSAdLRAB7jTI2WBfSEgF7kQI35Xez7mIkAUQRAz/HL5ABYiaoYHXwjEgJWowFmYXwra/tuVPIj50+QACAIH4kAM+dnFA0wMvjcwBmrOjN8bvA6vRC/CuOcAytZ/0ZRgHgiAGazf7PZtlOiwI7jB836CYIEAEHRgHijAUYRAj0hIArd6+UbWAn1MxjvYoBg5s9stBtMIgCA+V56s6UBQG79XpUQGKBZP0HIQ9sAiZTq7xZ+L1M7QO85owp9dl8X955/i0JAJgoAWKsNIDNbV+N4nRXHT7N+InGzEaoDQAKASGoRoOf89RLrrJw3YHVmr5jM8mVn/rKCR9YhWokEwILzFkUKrNTp5xaum5w/kfICgJYAiJQbgxLOkUs4zNhlALPkQUBL9JNJ5FPjnPV7sQTgRDQAFhw9OX6CIAFAEI4JAatFccyEgN57yzpyK6+RjVKYOX+zCIBZXQBRVMCqKLAiFOCg4yfnT5AAIAiKBjgiBGTqAgDWQ/x2t/rZiQLIrJfb3SIo85woqmBVjJDjJwgSAAThmhAA9DP8meB/sJi/Ea3rx7PezySfM/p8dgWAkRO34txlZvvk+AmCBABBJI0QMIsKQMfxc8jv63fD+TstAuJ17LKzfXL8BEECgCASJgSYgXNhOg5Lz2lznRm/XoliK8l9Vg8BMnOWVvIEZJMFZRy+yNmT4ycIEgAEkbQRAb3IAHQcvEgQQPBaIydvZ/YvGwVwSgzY+X/cxv0jCIIEAEG4KgTMnCMziA6IIgSiw4ogeD/mUhtYiRBYWafnFt+bHD9BkAAgCM+FQLxiwEgQGDlKo9cxyf/FHPi8sq/jFj6/Uw6fnD5BkAAgiKQVA1YFgZ4ogEQkQO85K9fKLf7OTpEdJxw+OX2CIAFAEL4UA0aOULR10EwcWHGMzGFnyuN4jpw+QZAAIIhAiQGrgkDkNOOZ1eu9zupM34loATl8giABQBApKwicFAYykQK/OGVy9ARBAoAgSBgE2ImSoycIEgAEQdhwkMzn108QBAkAgiAS6GCZS+9LEIRPYJzTuCcIgiCIVEOhJiAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBECQACIIgCIIgAUAQBEEQBAkAgiAIgiBIABAEQRAEQQKAIAiCIAgSAARBEARBkAAgCIIgCIIEAEEQBEEQJAAIgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEARBAoAgCIIgCBIABEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBECQACIIgCIIgAUAQBEEQBAkAgiAIgiBIABAEQRAEQQKAIAiCIAgSAARBEARBkAAgCIIgCIIEAEEQBEEQJAAIgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEARBAoAgCIIgSAAQBEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAiCBABBEARBECQACIIgCIIgAUAQBEEQBAkAgiAIgiBIABAEQRAEQQKAIAiCIAgSAARBEARBkAAgCIIgCIIEAEEQBEEQJAAIgiAIgiABQBAEQRAECQCCIAiCIEgAEARBEAQJAIIgCIIgSAAQBEEQBEECgCAIgiAIEgAEQRAEQZAAIAiCIAjCb/z/AHLvzuvWLx4jAAAAAElFTkSuQmCC\"/></center><center>ONYX FRAMEWORK</center></body></html>";
         }
 
@@ -0,0 +1,134 @@
+#ifndef RESPONSEWRITER_H
+#define RESPONSEWRITER_H
+
+#include <string>
+#include <string.h>
+#include <boost/utility/string_view.hpp>
+
+namespace onyx {
+
+    /*
+     * Output of the request being processed. Small writes are gathered in a fixed buffer
+     * and passed to the transport in blocks. A handler that writes its response here
+     * (see BaseResponse::send) returns an empty string. Until the first block is passed on
+     * the output can still be discarded, e.g. when the handler fails after sending the headers
+     */
+
+    class ResponseWriter {
+    private:
+        static const size_t BUFFER_SIZE = 8 * 1024;
+        char m_buffer[BUFFER_SIZE];
+        size_t m_size;
+        unsigned m_status;
+        bool m_used;
+        bool m_committed;
+
+    protected:
+        /*
+         * pass a block to the transport
+         */
+        virtual void writeBlock(const char * data, size_t size) = 0;
+
+    public:
+
+        ResponseWriter() : m_size(0), m_status(0), m_used(false), m_committed(false) {
+        }
+
+        virtual ~ResponseWriter() {
+        }
+
+        void write(const char * data, size_t size) {
+            m_used = true;
+            if (m_size + size > BUFFER_SIZE) {
+                flush();
+                if (size > BUFFER_SIZE) {
+                    m_committed = true;
+                    writeBlock(data, size);
+                    return;
+                }
+            }
+            memcpy(m_buffer + m_size, data, size);
+            m_size += size;
+        }
+
+        void write(boost::string_view data) {
+            write(data.data(), data.size());
+        }
+
+        void put(char ch) {
+            m_used = true;
+            if (m_size == BUFFER_SIZE)
+                flush();
+            m_buffer[m_size++] = ch;
+        }
+
+        void flush() {
+            if (m_size > 0) {
+                m_committed = true;
+                writeBlock(m_buffer, m_size);
+            }
+            m_size = 0;
+        }
+
+        /*
+         * drop the buffered output, false when part of it was already passed to the transport
+         */
+        bool discard() {
+            if (m_committed)
+                return false;
+            m_size = 0;
+            m_status = 0;
+            m_used = false;
+            return true;
+        }
+
+        /*
+         * status of the response whose headers were written, 0 before (see BaseResponse::send)
+         */
+        void setStatus(unsigned status) {
+            m_status = status;
+        }
+
+        unsigned getStatus() const {
+            return m_status;
+        }
+
+        /*
+         * true once output was passed to the transport, it can't be discarded anymore
+         */
+        bool isCommitted() const {
+            return m_committed;
+        }
+
+        /*
+         * true once anything was written
+         */
+        bool isUsed() const {
+            return m_used;
+        }
+    };
+
+    /*
+     * ResponseWriter collecting the output in a string
+     */
+
+    class StringResponseWriter : public ResponseWriter {
+    private:
+        std::string m_output;
+
+    protected:
+
+        virtual void writeBlock(const char * data, size_t size) override {
+            m_output.append(data, size);
+        }
+
+    public:
+
+        const std::string & getOutput() {
+            flush();
+            return m_output;
+        }
+    };
+}
+
+#endif
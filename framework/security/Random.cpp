@@ -0,0 +1,149 @@
+#include "Random.h"
+#include <cstring>
+#include <cerrno>
+#include <mutex>
+#include <pthread.h>
+#include <sys/random.h>
+
+const size_t onyx::Random::BUFFER_SIZE;
+const size_t onyx::Random::RESEED_BYTES;
+
+thread_local onyx::Random::State onyx::Random::m_state;
+std::atomic<uint64_t> onyx::Random::m_fork_generation(0);
+
+namespace {
+
+    inline uint32_t rotl(uint32_t x, int n) {
+        return (x << n) | (x >> (32 - n));
+    }
+
+    inline void quarter_round(uint32_t * x, int a, int b, int c, int d) {
+        x[a] += x[b];
+        x[d] = rotl(x[d] ^ x[a], 16);
+        x[c] += x[d];
+        x[b] = rotl(x[b] ^ x[c], 12);
+        x[a] += x[b];
+        x[d] = rotl(x[d] ^ x[a], 8);
+        x[c] += x[d];
+        x[b] = rotl(x[b] ^ x[c], 7);
+    }
+
+    /*
+     * ChaCha20 block (RFC 8439) with a 64-bit counter and a zero nonce
+     */
+    void chacha20_block(const uint32_t key[8], uint64_t counter, unsigned char output[64]) {
+        uint32_t state[16] = {
+            0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+            key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+            static_cast<uint32_t> (counter), static_cast<uint32_t> (counter >> 32), 0, 0
+        };
+        uint32_t x[16];
+        memcpy(x, state, sizeof (x));
+        for (int i = 0; i < 10; i++) {
+            quarter_round(x, 0, 4, 8, 12);
+            quarter_round(x, 1, 5, 9, 13);
+            quarter_round(x, 2, 6, 10, 14);
+            quarter_round(x, 3, 7, 11, 15);
+            quarter_round(x, 0, 5, 10, 15);
+            quarter_round(x, 1, 6, 11, 12);
+            quarter_round(x, 2, 7, 8, 13);
+            quarter_round(x, 3, 4, 9, 14);
+        }
+        for (int i = 0; i < 16; i++) {
+            uint32_t word = x[i] + state[i];
+            output[i * 4] = static_cast<unsigned char> (word);
+            output[i * 4 + 1] = static_cast<unsigned char> (word >> 8);
+            output[i * 4 + 2] = static_cast<unsigned char> (word >> 16);
+            output[i * 4 + 3] = static_cast<unsigned char> (word >> 24);
+        }
+    }
+
+    std::once_flag fork_handler_flag;
+}
+
+void onyx::Random::seed(State & state) {
+    std::call_once(fork_handler_flag, []() {
+        pthread_atfork(nullptr, nullptr, []() {
+            m_fork_generation.fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+    unsigned char * key = reinterpret_cast<unsigned char *> (state.m_key);
+    size_t read = 0;
+    while (read < sizeof (state.m_key)) {
+        ssize_t rc = getrandom(key + read, sizeof (state.m_key) - read, 0);
+        if (rc < 0) {
+            if (errno == EINTR)
+                continue;
+            throw onyx::Exception(std::string("Can't seed the random generator: ") + strerror(errno));
+        }
+        read += rc;
+    }
+    state.m_counter = 0;
+    state.m_available = 0;
+    state.m_generated = 0;
+    state.m_fork_generation = m_fork_generation.load(std::memory_order_relaxed);
+    state.m_seeded = true;
+}
+
+void onyx::Random::refill(State & state) {
+    for (size_t i = 0; i < BUFFER_SIZE; i += 64)
+        chacha20_block(state.m_key, state.m_counter++, state.m_buffer + i);
+    // the first 32 bytes become the next key and are never handed out
+    memcpy(state.m_key, state.m_buffer, sizeof (state.m_key));
+    memset(state.m_buffer, 0, sizeof (state.m_key));
+    state.m_available = BUFFER_SIZE - sizeof (state.m_key);
+}
+
+void onyx::Random::fill(void * data, size_t size) {
+    State & state = m_state;
+    if (!state.m_seeded || state.m_generated >= RESEED_BYTES || state.m_fork_generation != m_fork_generation.load(std::memory_order_relaxed))
+        seed(state);
+    unsigned char * output = static_cast<unsigned char *> (data);
+    while (size > 0) {
+        if (state.m_available == 0)
+            refill(state);
+        size_t copied = size < state.m_available ? size : state.m_available;
+        unsigned char * source = state.m_buffer + BUFFER_SIZE - state.m_available;
+        memcpy(output, source, copied);
+        // bytes handed out don't stay in memory
+        memset(source, 0, copied);
+        state.m_available -= copied;
+        state.m_generated += copied;
+        output += copied;
+        size -= copied;
+    }
+}
+
+void onyx::Random::hex(char * output, size_t size) {
+    static const char digits[] = "0123456789abcdef";
+    unsigned char bytes[48];
+    while (size > 0) {
+        size_t chunk = size < sizeof (bytes) ? size : sizeof (bytes);
+        fill(bytes, chunk);
+        for (size_t i = 0; i < chunk; i++) {
+            *output++ = digits[bytes[i] >> 4];
+            *output++ = digits[bytes[i] & 0x0f];
+        }
+        size -= chunk;
+    }
+    memset(bytes, 0, sizeof (bytes));
+}
+
+void onyx::Random::base64url(char * output, size_t size) {
+    // chunks are multiples of 3 bytes, so they encode without padding
+    unsigned char bytes[48];
+    while (size > 0) {
+        size_t chunk = size < sizeof (bytes) ? size : sizeof (bytes);
+        fill(bytes, chunk);
+        onyx::utils::base64url_encode(bytes, chunk, output);
+        output += onyx::utils::base64url_size(chunk);
+        size -= chunk;
+    }
+    memset(bytes, 0, sizeof (bytes));
+}
+
+std::string onyx::Random::id(size_t size) {
+    std::string id(onyx::utils::base64url_size(size), '\0');
+    base64url(&id[0], size);
+    return id;
+}
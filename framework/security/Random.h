@@ -0,0 +1,68 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <atomic>
+#include "../exception/Exception.h"
+#include "../common/utils.h"
+
+namespace onyx {
+
+    /*
+     * Cryptographically secure random bytes for session ids and CSRF tokens. Every thread runs its own
+     * ChaCha20 generator seeded from getrandom: no lock and no system call per id. The key is replaced
+     * with generator output after every buffer (a leaked state doesn't reveal earlier ids), the generator
+     * is seeded again every RESEED_BYTES and in the child after fork
+     */
+    class Random {
+    private:
+
+        static const size_t BUFFER_SIZE = 512;
+        static const size_t RESEED_BYTES = 1 << 20;
+
+        struct State {
+            uint32_t m_key[8];
+            uint64_t m_counter = 0;
+            unsigned char m_buffer[BUFFER_SIZE];
+            size_t m_available = 0;
+            size_t m_generated = 0;
+            uint64_t m_fork_generation = 0;
+            bool m_seeded = false;
+        };
+
+        static thread_local State m_state;
+        /*
+         * bumped in the child after fork, threads compare it with the generation of their seed
+         */
+        static std::atomic<uint64_t> m_fork_generation;
+
+        static void seed(State & state);
+        static void refill(State & state);
+
+    public:
+
+        /*
+         * Throws onyx::Exception when the system has no random source
+         */
+        static void fill(void * data, size_t size);
+
+        /*
+         * size random bytes as 2 * size hex characters, output isn't terminated
+         */
+        static void hex(char * output, size_t size);
+
+        /*
+         * size random bytes as onyx::utils::base64url_size(size) base64url characters, output isn't terminated
+         */
+        static void base64url(char * output, size_t size);
+
+        /*
+         * identifier of size random bytes in base64url, for session ids and CSRF tokens
+         */
+        static std::string id(size_t size = 24);
+    };
+}
+
+#endif
@@ -0,0 +1,101 @@
+#include "RoleRegistry.h"
+
+onyx::RoleRegistry * onyx::RoleRegistry::m_instance = nullptr;
+
+const size_t onyx::RoleRegistry::MAX_ROLES;
+
+onyx::RoleRegistry::RoleRegistry() : m_snapshot(nullptr) {
+    publish();
+}
+
+size_t onyx::RoleRegistry::intern(const std::string & role) {
+    auto it = m_ids.find(role);
+    if (it != m_ids.end())
+        return it->second;
+    size_t id = m_ids.size();
+    if (id >= MAX_ROLES)
+        throw onyx::Exception("Too many roles, at most " + std::to_string(MAX_ROLES) + " are supported");
+    m_ids.emplace(role, id);
+    m_includes.push_back(0);
+    m_expanded.push_back(uint64_t(1) << id);
+    return id;
+}
+
+void onyx::RoleRegistry::expand() {
+    for (size_t id = 0; id < m_expanded.size(); id++)
+        m_expanded[id] = (uint64_t(1) << id) | m_includes[id];
+    // repeated until nothing changes, which covers chains and cycles of inclusions
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t id = 0; id < m_expanded.size(); id++) {
+            uint64_t expanded = m_expanded[id];
+            for (size_t other = 0; other < m_expanded.size(); other++) {
+                if (m_expanded[id] & (uint64_t(1) << other))
+                    expanded |= m_expanded[other];
+            }
+            if (expanded != m_expanded[id]) {
+                m_expanded[id] = expanded;
+                changed = true;
+            }
+        }
+    }
+}
+
+void onyx::RoleRegistry::publish() {
+    std::unique_ptr<Snapshot> snapshot(new Snapshot);
+    for (auto & id : m_ids)
+        snapshot->emplace(id.first, m_expanded[id.second]);
+    m_snapshot.store(snapshot.get(), std::memory_order_release);
+    m_snapshots.push_back(std::move(snapshot));
+}
+
+uint64_t onyx::RoleRegistry::getMask(const std::vector<std::string> & roles) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = m_ids.size();
+    uint64_t mask = 0;
+    try {
+        for (const std::string & role : roles)
+            mask |= uint64_t(1) << intern(role);
+    } catch (...) {
+        if (m_ids.size() != count)
+            publish();
+        throw;
+    }
+    if (m_ids.size() != count)
+        publish();
+    return mask;
+}
+
+void onyx::RoleRegistry::addInclusion(const std::string & role, const std::vector<std::string> & included) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t id = intern(role);
+    for (const std::string & other : included)
+        m_includes[id] |= uint64_t(1) << intern(other);
+    expand();
+    publish();
+}
+
+uint64_t onyx::RoleRegistry::resolve(boost::string_view roles) const {
+    const Snapshot * snapshot = m_snapshot.load(std::memory_order_acquire);
+    uint64_t mask = 0;
+    std::string role;
+    while (!roles.empty()) {
+        size_t comma = roles.find(',');
+        boost::string_view item = roles.substr(0, comma);
+        roles.remove_prefix(comma == boost::string_view::npos ? roles.size() : comma + 1);
+        while (!item.empty() && item.front() == ' ')
+            item.remove_prefix(1);
+        while (!item.empty() && item.back() == ' ')
+            item.remove_suffix(1);
+        role.assign(item.data(), item.size());
+        auto it = snapshot->find(role);
+        if (it != snapshot->end())
+            mask |= it->second;
+    }
+    return mask;
+}
+
+size_t onyx::RoleRegistry::size() const {
+    return m_snapshot.load(std::memory_order_acquire)->size();
+}
@@ -0,0 +1,91 @@
+#ifndef ROLEREGISTRY_H
+#define ROLEREGISTRY_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include "../exception/Exception.h"
+
+namespace onyx {
+
+    /*
+     * Roles interned into bits of a 64-bit mask. Routes keep the mask of the roles they accept
+     * (getMask), sessions the mask of the roles of their user (resolve), access is granted when the
+     * masks intersect. A role including others (addInclusion) gets their bits when it's resolved, the
+     * inclusions are expanded when they are registered. Roles and inclusions are meant to be
+     * registered before the application starts serving requests. resolve takes no lock: registration
+     * publishes an immutable snapshot of the expanded roles
+     */
+    class RoleRegistry {
+    private:
+        static RoleRegistry * m_instance;
+
+        /*
+         * role -> its own bit and the bits of every role it includes
+         */
+        typedef std::unordered_map<std::string, uint64_t> Snapshot;
+
+        std::atomic<const Snapshot *> m_snapshot;
+        /*
+         * every snapshot published, kept since readers may still use an older one
+         */
+        std::vector<std::unique_ptr<const Snapshot>> m_snapshots;
+
+        std::mutex m_mutex;
+        std::unordered_map<std::string, size_t> m_ids;
+        /*
+         * by role id: bits of the roles it includes directly
+         */
+        std::vector<uint64_t> m_includes;
+        /*
+         * by role id: its own bit and the bits of every role it includes, directly or not
+         */
+        std::vector<uint64_t> m_expanded;
+
+        RoleRegistry();
+
+        /*
+         * the mutex must be locked for intern, expand and publish
+         */
+        size_t intern(const std::string & role);
+
+        void expand();
+
+        void publish();
+
+    public:
+
+        static const size_t MAX_ROLES = 64;
+
+        static RoleRegistry * getInstance() noexcept {
+            if (m_instance == nullptr)
+                m_instance = new RoleRegistry;
+            return m_instance;
+        }
+
+        /*
+         * bits of the roles, unknown roles are interned. Throws onyx::Exception past MAX_ROLES roles
+         */
+        uint64_t getMask(const std::vector<std::string> & roles);
+
+        /*
+         * a user with the role also has the included roles, e.g. addInclusion("admin", {"editor"})
+         */
+        void addInclusion(const std::string & role, const std::vector<std::string> & included);
+
+        /*
+         * bits of a comma separated list of roles with the roles they include, unknown roles
+         * have no bit
+         */
+        uint64_t resolve(boost::string_view roles) const;
+
+        size_t size() const;
+    };
+}
+
+#endif
@@ -1,41 +1,266 @@
 #include "Security.h"
 #include "../request/Request.h"
+#include "../metrics/Metrics.h"
+#include "../response/PlainTextResponse.h"
 
 onyx::Security * onyx::Security::m_instance = nullptr;
+const size_t onyx::Security::SESSION_REMOVE_STRIPES;
 
 //std::function<onyx::session::User * (const std::string & login, const std::string & password) > onyx::Security::callbackUser = nullptr;
 
 onyx::Security::Security() {
     m_session_storage = nullptr;
+    m_session_backend = nullptr;
+    m_write_behind_enabled = false;
+    m_session_storage_v2 = nullptr;
+    m_batch_window = std::chrono::microseconds(0);
+    m_batch_size = 64;
+    m_session_filter_capacity = 0;
+    m_session_filter_rate = 0.01;
+    m_session_filter_rejected = 0;
+    m_session_filter_interval = std::chrono::seconds(0);
+    m_session_filter_stop = false;
     m_callbackUser = nullptr;
     m_login_url = "/login";
     m_auth_url = "/auth";
     m_redirect_url = "/";
+    m_signed_session_ttl = std::chrono::seconds(60 * 60 * 24 * 30);
+    m_revoked_count = 0;
 }
 
 const std::function<std::string(onyx::ONObject &)> onyx::Security::fetchAuthHandler() {
     return [](onyx::ONObject & obj) -> std::string {
         onyx::Security * security = onyx::Security::getInstance();
         std::stringstream stream;
-        boost::uuids::uuid uuid = boost::uuids::random_generator()();
-        boost::uuids::uuid token = boost::uuids::random_generator()();
-        time_t expires = time(NULL) + 60 * 60 * 24 * 30;
+        time_t expires = time(NULL) + (security->isSignedSessions() ? security->m_signed_session_ttl.count() : 60 * 60 * 24 * 30);
         char buff[40];
         strftime(buff, sizeof (buff), "%a, %d-%b-%Y %H:%M:%S", localtime(&expires));
-        std::map<std::string, std::string> m = onyx::Request::parse_form_params(obj.getBody());
+        onyx::ParamCollection & form_params = obj.getFormParams();
         std::string login = "";
         std::string password = "";
-        if (m.find("login") != m.end())
-            m["login"];
-        if (m.find("password") != m.end())
-            password = m["password"];
+        if (form_params.has("login"))
+            login = form_params["login"];
+        if (form_params.has("password"))
+            password = form_params["password"];
         std::unique_ptr<onyx::session::User> user(security->getCallbackUser()(login, password));
         if (user == nullptr)
             return onyx::RedirectResponse("Login", security->getLoginURL());
         std::string response = onyx::RedirectResponse("Login", security->getRedirectURL());
-        stream << "Set-Cookie: sessionid=" << boost::lexical_cast<std::string>(uuid) << "; expires=" << buff << "; HttpOnly;\r\n " << response;
-        security->getSessionStorage()->createSession(boost::lexical_cast<std::string>(uuid), boost::lexical_cast<std::string>(token), user->getId());
+        // 192 random bits each, 32 base64url characters
+        char id_buffer[32];
+        char token_buffer[32];
+        onyx::Random::base64url(id_buffer, 24);
+        onyx::Random::base64url(token_buffer, 24);
+        std::string sessionid(id_buffer, sizeof (id_buffer));
+        std::string token(token_buffer, sizeof (token_buffer));
+        if (security->isSignedSessions())
+            sessionid = security->m_signed_session->encode(sessionid, token, *user, expires);
+        else {
+            // a storage dropping the session (full, fields too long) would send the user back to the login page
+            if (!security->getSessionStorage()->createSession(sessionid, token, *user)) {
+                LOGE << "The session storage didn't keep a new session, login of user " << user->getId() << " refused";
+                onyx::PlainTextResponse error("The session can't be created");
+                error.addHeader("Status: 500 Internal Server Error");
+                return error;
+            }
+            // counted once stored, the cookie isn't sent yet so no request can be rejected meanwhile
+            security->addToSessionFilter(sessionid);
+            // the first requests after the login are served from memory while the write is queued
+            if (security->m_session_cache)
+                security->m_session_cache->put(sessionid, std::make_shared<const onyx::Session>(sessionid, token, *user));
+        }
+        stream << "Set-Cookie: sessionid=" << sessionid << "; expires=" << buff << "; HttpOnly;\r\n " << response;
         return stream.str();
     };
 
-}
\ No newline at end of file
+}
+void onyx::Security::revokeSession(const std::string & id, time_t expires) {
+    time_t now = time(NULL);
+    std::lock_guard<std::mutex> lock(m_revoked_mutex);
+    for (auto it = m_revoked.begin(); it != m_revoked.end();) {
+        if (it->second <= now)
+            it = m_revoked.erase(it);
+        else
+            ++it;
+    }
+    m_revoked[id] = expires;
+    m_revoked_count = m_revoked.size();
+}
+
+bool onyx::Security::isRevoked(const std::string & id) {
+    // no lock while nothing is revoked
+    if (m_revoked_count.load(std::memory_order_acquire) == 0)
+        return false;
+    std::lock_guard<std::mutex> lock(m_revoked_mutex);
+    return m_revoked.find(id) != m_revoked.end();
+}
+
+void onyx::Security::updateSessionStorage() {
+    // the rebuilds list the storage being replaced
+    stopSessionFilterRebuilds();
+    m_session_batcher.reset();
+    m_session_adapter.reset();
+    // the old queue is written to its storage before it is destroyed
+    m_write_behind.reset();
+    if (m_write_behind_enabled && m_session_backend != nullptr) {
+        m_write_behind.reset(new WriteBehindStorage(m_session_backend, m_write_behind_settings));
+        m_session_storage = m_write_behind.get();
+    } else
+        m_session_storage = m_session_backend;
+    m_session_storage_v2 = dynamic_cast<ISessionStorageV2 *> (m_session_storage);
+    if (m_session_storage_v2 == nullptr && m_session_storage != nullptr) {
+        m_session_adapter.reset(new SyncSessionStorageAdapter(m_session_storage));
+        m_session_storage_v2 = m_session_adapter.get();
+    }
+    if (m_batch_window.count() > 0 && m_session_storage_v2 != nullptr)
+        m_session_batcher.reset(new SessionBatcher(m_session_storage_v2, m_batch_window, m_batch_size));
+    if (m_session_filter_capacity > 0 && rebuildSessionFilter())
+        startSessionFilterRebuilds();
+}
+
+void onyx::Security::setSessionFilter(size_t capacity, double false_positive_rate, std::chrono::seconds rebuild_interval) {
+    stopSessionFilterRebuilds();
+    m_session_filter_capacity = capacity;
+    m_session_filter_rate = false_positive_rate;
+    m_session_filter_interval = rebuild_interval;
+    if (rebuildSessionFilter())
+        startSessionFilterRebuilds();
+}
+
+void onyx::Security::startSessionFilterRebuilds() {
+    if (m_session_filter_interval.count() <= 0 || m_session_filter_thread.joinable())
+        return;
+    m_session_filter_stop = false;
+    m_session_filter_thread = std::thread(&Security::runSessionFilterRebuilds, this);
+}
+
+void onyx::Security::stopSessionFilterRebuilds() {
+    if (!m_session_filter_thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(m_session_filter_thread_mutex);
+        m_session_filter_stop = true;
+    }
+    m_session_filter_wake.notify_one();
+    m_session_filter_thread.join();
+}
+
+void onyx::Security::runSessionFilterRebuilds() {
+    std::unique_lock<std::mutex> lock(m_session_filter_thread_mutex);
+    while (!m_session_filter_wake.wait_for(lock, m_session_filter_interval, [this]() {
+            return m_session_filter_stop;
+        })) {
+        lock.unlock();
+        rebuildSessionFilter();
+        lock.lock();
+    }
+}
+
+bool onyx::Security::rebuildSessionFilter() {
+    std::lock_guard<std::mutex> rebuild_lock(m_session_filter_rebuild_mutex);
+    if (m_session_filter_capacity == 0 || m_session_storage == nullptr || m_session_storage->isShared()) {
+        // another process's login would be rejected here until the next rebuild
+        if (m_session_filter_capacity > 0 && m_session_storage != nullptr)
+            LOGE << "The session storage is shared by other processes, the session filter is disabled";
+        std::lock_guard<std::mutex> lock(m_session_filter_mutex);
+        std::atomic_store(&m_session_filter, std::shared_ptr<SessionFilter>());
+        return false;
+    }
+    std::shared_ptr<SessionFilter> filter = std::make_shared<SessionFilter>(m_session_filter_capacity, m_session_filter_rate);
+    {
+        std::lock_guard<std::mutex> lock(m_session_filter_mutex);
+        std::atomic_store(&m_session_filter_building, filter);
+    }
+    bool listed = m_session_storage->enumerateSessions([&filter](const std::string & id) {
+        filter->add(id);
+    });
+    std::lock_guard<std::mutex> lock(m_session_filter_mutex);
+    std::atomic_store(&m_session_filter_building, std::shared_ptr<SessionFilter>());
+    if (!listed) {
+        LOGE << "The session storage can't list its sessions, the session filter is disabled";
+        std::atomic_store(&m_session_filter, std::shared_ptr<SessionFilter>());
+        return false;
+    }
+    std::atomic_store(&m_session_filter, filter);
+    return true;
+}
+
+void onyx::Security::addToSessionFilter(const std::string & id) {
+    std::lock_guard<std::mutex> lock(m_session_filter_mutex);
+    if (m_session_filter)
+        m_session_filter->add(id);
+    if (m_session_filter_building)
+        m_session_filter_building->add(id);
+}
+
+std::shared_ptr<const onyx::Session> onyx::Security::fetchSession(const std::string & id) {
+    if (id.empty())
+        return nullptr;
+    if (m_signed_session) {
+        std::shared_ptr<const Session> session = m_signed_session->decode(id, time(NULL));
+        if (session && isRevoked(session->getId()))
+            return nullptr;
+        return session;
+    }
+    if (m_session_storage == nullptr)
+        return nullptr;
+    std::shared_ptr<SessionFilter> filter = std::atomic_load(&m_session_filter);
+    if (filter && !filter->contains(id)) {
+        m_session_filter_rejected.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    std::shared_ptr<const Session> session;
+    if (m_session_cache) {
+        session = m_session_cache->get(id);
+        if (session)
+            return session;
+    }
+    uint64_t removals = m_session_cache ? m_session_cache->getRemovals(id) : 0;
+    onyx::Metrics * metrics = onyx::Metrics::getInstance();
+    uint64_t start = metrics->isEnabled() ? onyx::Metrics::now() : 0;
+    if (m_session_batcher)
+        session = m_session_batcher->fetch(id);
+    else
+        session.reset(m_session_storage->fetchSession(id));
+    if (metrics->isEnabled())
+        metrics->recordSessionFetch(onyx::Metrics::now() - start);
+    if (session && m_session_cache)
+        m_session_cache->put(id, session, removals);
+    return session;
+}
+
+void onyx::Security::removeSession(const std::string & id) {
+    if (m_signed_session) {
+        time_t expires;
+        std::shared_ptr<const Session> session = m_signed_session->decode(id, time(NULL), &expires);
+        if (session)
+            revokeSession(session->getId(), expires);
+        return;
+    }
+    // evicted after the storage: a lookup that read the session before the removal doesn't cache it
+    // again (see SessionCache::getRemovals)
+    removeStoredSession(id);
+    if (m_session_cache)
+        m_session_cache->remove(id);
+}
+
+void onyx::Security::removeStoredSession(const std::string & id) {
+    if (m_session_storage == nullptr)
+        return;
+    std::shared_ptr<SessionFilter> filter = std::atomic_load(&m_session_filter);
+    // an id the filter doesn't hold has nothing to decrement, no need to read the session back
+    if (!filter || !filter->contains(id)) {
+        m_session_storage->removeSession(id);
+        return;
+    }
+    // Only the logout removing a stored session decrements the filter, once: decrementing for an id
+    // it doesn't hold could hide live sessions. The filter is loaded before the removal, a filter
+    // swapped in later was listed while the session was stored or got it from the login.
+    // Logouts of the same id share a stripe, the others don't wait on each other
+    std::lock_guard<std::mutex> lock(m_session_remove_mutexes[std::hash<std::string>()(id) % SESSION_REMOVE_STRIPES]);
+    filter = std::atomic_load(&m_session_filter);
+    std::unique_ptr<Session> stored(m_session_storage->fetchSession(id));
+    m_session_storage->removeSession(id);
+    if (stored && filter && filter->contains(id))
+        filter->remove(id);
+}
@@ -5,18 +5,26 @@
 #include "../cookie/Cookie.h"
 #include <string>
 #include "../exception/Exception.h"
-#include <boost/uuid/uuid.hpp>            
 #include "../common/json/json.hpp"
 #include "../session/Session.h"
 #include <memory>
 #include <sstream>
-#include <boost/uuid/uuid.hpp>            
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/lexical_cast.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+#include <unordered_map>
 #include "../response/RedirectResponse.h"
 #include "../object/ONObject.h"
 #include "../session/Session.h"
+#include "../session/SessionCache.h"
+#include "../session/WriteBehindStorage.h"
+#include "../session/SyncSessionStorageAdapter.h"
+#include "../session/SessionBatcher.h"
+#include "../session/SessionFilter.h"
+#include "SignedSession.h"
+#include "Random.h"
 #include "../validate/ValidateXSS.h"
 
 namespace onyx {
@@ -29,10 +37,69 @@ namespace onyx {
         std::string m_redirect_url;
         
         ISessionStorage * m_session_storage;
+        /*
+         * storage given to setSessionStorage, m_session_storage is the write-behind queue in front of it when enabled
+         */
+        ISessionStorage * m_session_backend;
+        std::unique_ptr<WriteBehindStorage> m_write_behind;
+        bool m_write_behind_enabled;
+        WriteBehindStorage::Settings m_write_behind_settings;
+        /*
+         * m_session_storage as ISessionStorageV2, through m_session_adapter when it is synchronous
+         */
+        ISessionStorageV2 * m_session_storage_v2;
+        std::unique_ptr<SyncSessionStorageAdapter> m_session_adapter;
+        std::unique_ptr<SessionBatcher> m_session_batcher;
+        std::chrono::microseconds m_batch_window;
+        size_t m_batch_size;
+        /*
+         * live session ids, read with std::atomic_load. Logins add to the filter being rebuilt as well
+         */
+        std::shared_ptr<SessionFilter> m_session_filter;
+        std::shared_ptr<SessionFilter> m_session_filter_building;
+        size_t m_session_filter_capacity;
+        double m_session_filter_rate;
+        std::mutex m_session_filter_mutex;
+        std::mutex m_session_filter_rebuild_mutex;
+        /*
+         * the filter is built again every m_session_filter_interval by m_session_filter_thread,
+         * sessions expired in the storage leave it then
+         */
+        std::chrono::seconds m_session_filter_interval;
+        std::thread m_session_filter_thread;
+        std::mutex m_session_filter_thread_mutex;
+        std::condition_variable m_session_filter_wake;
+        bool m_session_filter_stop;
+        /*
+         * serialize the logouts of an id while the filter is enabled
+         */
+        static const size_t SESSION_REMOVE_STRIPES = 64;
+        std::mutex m_session_remove_mutexes[SESSION_REMOVE_STRIPES];
+        std::atomic<uint64_t> m_session_filter_rejected;
+        std::unique_ptr<SessionCache> m_session_cache;
+        std::unique_ptr<SignedSession> m_signed_session;
+        std::chrono::seconds m_signed_session_ttl;
+        /*
+         * revoked signed session id -> expiry of its cookie
+         */
+        std::unordered_map<std::string, time_t> m_revoked;
+        std::atomic<size_t> m_revoked_count;
+        std::mutex m_revoked_mutex;
         
         static Security * m_instance;
         
         Security();
+
+        void updateSessionStorage();
+        void addToSessionFilter(const std::string & id);
+        void startSessionFilterRebuilds();
+        void stopSessionFilterRebuilds();
+        void runSessionFilterRebuilds();
+
+        /*
+         * remove the session from the storage and the filter
+         */
+        void removeStoredSession(const std::string & id);
         
         std::function<onyx::session::User * (const std::string & login, const std::string & password) > m_callbackUser;
         
@@ -71,12 +138,120 @@ namespace onyx {
         }
 
         void setSessionStorage(ISessionStorage* session_storage) {
-            m_session_storage = session_storage;
+            m_session_backend = session_storage;
+            updateSessionStorage();
         }
         
+        /*
+            the write-behind queue when enabled
+        */
         ISessionStorage* getSessionStorage() const {
             return m_session_storage;
         }
+
+        /*
+            write sessions to the storage from a background thread (see onyx::WriteBehindStorage),
+            logins then don't wait on the storage
+        */
+        void setSessionWriteBehind(bool enabled, const WriteBehindStorage::Settings & settings = WriteBehindStorage::Settings()) {
+            m_write_behind_enabled = enabled;
+            m_write_behind_settings = settings;
+            updateSessionStorage();
+        }
+
+        /*
+            the session storage with asynchronous and batched lookups, nullptr without a storage
+        */
+        ISessionStorageV2* getSessionStorageV2() const {
+            return m_session_storage_v2;
+        }
+
+        /*
+            look up the sessions of concurrent requests together: the first lookup waits up to window
+            for up to max_batch ids (see onyx::SessionBatcher). A zero window disables it
+        */
+        void setSessionBatching(std::chrono::microseconds window, size_t max_batch = 64) {
+            m_batch_window = window;
+            m_batch_size = max_batch;
+            updateSessionStorage();
+        }
+
+        /*
+            keep up to capacity sessions in memory for ttl, requests of a logged-in user then
+            don't reach the storage. Capacity 0 disables the cache.
+            The cache only sees the logouts of this process: with several worker processes sharing
+            the storage (e.g. FileSessionStorage) a session removed by another process stays valid
+            here for up to ttl
+        */
+        void setSessionCache(size_t capacity, std::chrono::seconds ttl, size_t shards = 16) {
+            if (capacity == 0)
+                m_session_cache.reset();
+            else
+                m_session_cache.reset(new SessionCache(capacity, ttl, shards));
+        }
+
+        /*
+            nullptr when the cache is disabled
+        */
+        SessionCache * getSessionCache() const {
+            return m_session_cache.get();
+        }
+
+        /*
+            keep a filter of the live session ids, cookies it rejects are anonymous without a storage lookup.
+            The filter is built from ISessionStorage::enumerateSessions, and again every rebuild_interval
+            so that the sessions expired in the storage leave it (0 never rebuilds it). It only sees the
+            logins of this process, so it is disabled when the storage is shared by other processes
+            (ISessionStorage::isShared, e.g. FileSessionStorage) or can't list its sessions.
+            Capacity 0 disables it
+        */
+        void setSessionFilter(size_t capacity, double false_positive_rate = 0.01, std::chrono::seconds rebuild_interval = std::chrono::seconds(300));
+
+        /*
+            false when the filter is disabled
+        */
+        bool rebuildSessionFilter();
+
+        std::shared_ptr<const SessionFilter> getSessionFilter() const {
+            return std::atomic_load(&m_session_filter);
+        }
+
+        /*
+            lookups answered by the filter alone
+        */
+        uint64_t getSessionFilterRejected() const {
+            return m_session_filter_rejected.load(std::memory_order_relaxed);
+        }
+
+        /*
+            sessions carried by cookies signed with key (HMAC-SHA256, at least 32 bytes) instead of the storage,
+            they expire after ttl. Throws onyx::Exception for a short key
+        */
+        void setSessionSigningKey(const std::string & key, std::chrono::seconds ttl = std::chrono::seconds(60 * 60 * 24 * 30)) {
+            m_signed_session.reset(new SignedSession(key));
+            m_signed_session_ttl = ttl;
+        }
+
+        bool isSignedSessions() const {
+            return m_signed_session != nullptr;
+        }
+
+        /*
+            reject the signed session until its cookie expires. The list is kept by the process
+        */
+        void revokeSession(const std::string & id, time_t expires);
+
+        bool isRevoked(const std::string & id);
+
+        /*
+            session from the signed cookie, the cache or the storage, nullptr for an empty id or an unknown session
+        */
+        std::shared_ptr<const Session> fetchSession(const std::string & id);
+
+        /*
+            remove the session from the storage and the cache, a signed session is revoked
+        */
+        void removeSession(const std::string & id);
         
         void setCallbackUser(std::function<onyx::session::User*(const std::string&, const std::string&)> callback) {
             m_callbackUser = callback;
@@ -0,0 +1,137 @@
+#include "Sha256.h"
+#include <cstring>
+#include <algorithm>
+
+const size_t onyx::Sha256::DIGEST_SIZE;
+const size_t onyx::Sha256::BLOCK_SIZE;
+
+namespace {
+
+    const uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    inline uint32_t rotr(uint32_t x, int n) {
+        return (x >> n) | (x << (32 - n));
+    }
+}
+
+onyx::Sha256::Sha256() : m_state{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19},
+m_length(0), m_block_size(0) {
+}
+
+void onyx::Sha256::transform(const unsigned char * block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) | (uint32_t(block[i * 4 + 2]) << 8) | block[i * 4 + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+    uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+        uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+    m_state[5] += f;
+    m_state[6] += g;
+    m_state[7] += h;
+}
+
+void onyx::Sha256::update(const void * data, size_t size) {
+    const unsigned char * bytes = static_cast<const unsigned char *> (data);
+    m_length += size;
+    if (m_block_size > 0) {
+        size_t copied = std::min(size, BLOCK_SIZE - m_block_size);
+        memcpy(m_block + m_block_size, bytes, copied);
+        m_block_size += copied;
+        bytes += copied;
+        size -= copied;
+        if (m_block_size < BLOCK_SIZE)
+            return;
+        transform(m_block);
+        m_block_size = 0;
+    }
+    for (; size >= BLOCK_SIZE; bytes += BLOCK_SIZE, size -= BLOCK_SIZE)
+        transform(bytes);
+    memcpy(m_block, bytes, size);
+    m_block_size = size;
+}
+
+void onyx::Sha256::finish(unsigned char digest[DIGEST_SIZE]) {
+    uint64_t bits = m_length * 8;
+    m_block[m_block_size++] = 0x80;
+    if (m_block_size > BLOCK_SIZE - 8) {
+        memset(m_block + m_block_size, 0, BLOCK_SIZE - m_block_size);
+        transform(m_block);
+        m_block_size = 0;
+    }
+    memset(m_block + m_block_size, 0, BLOCK_SIZE - 8 - m_block_size);
+    for (int i = 0; i < 8; i++)
+        m_block[BLOCK_SIZE - 1 - i] = static_cast<unsigned char> (bits >> (i * 8));
+    transform(m_block);
+    for (int i = 0; i < 8; i++) {
+        digest[i * 4] = static_cast<unsigned char> (m_state[i] >> 24);
+        digest[i * 4 + 1] = static_cast<unsigned char> (m_state[i] >> 16);
+        digest[i * 4 + 2] = static_cast<unsigned char> (m_state[i] >> 8);
+        digest[i * 4 + 3] = static_cast<unsigned char> (m_state[i]);
+    }
+}
+
+void onyx::Sha256::hash(boost::string_view data, unsigned char digest[DIGEST_SIZE]) {
+    Sha256 sha;
+    sha.update(data);
+    sha.finish(digest);
+}
+
+void onyx::Sha256::hmac(boost::string_view key, boost::string_view message, unsigned char digest[DIGEST_SIZE]) {
+    unsigned char block[BLOCK_SIZE] = {0};
+    // keys longer than a block are hashed first
+    if (key.size() > BLOCK_SIZE)
+        hash(key, block);
+    else
+        memcpy(block, key.data(), key.size());
+    unsigned char pad[BLOCK_SIZE];
+    for (size_t i = 0; i < BLOCK_SIZE; i++)
+        pad[i] = block[i] ^ 0x36;
+    unsigned char inner[DIGEST_SIZE];
+    Sha256 sha_inner;
+    sha_inner.update(pad, BLOCK_SIZE);
+    sha_inner.update(message);
+    sha_inner.finish(inner);
+    for (size_t i = 0; i < BLOCK_SIZE; i++)
+        pad[i] = block[i] ^ 0x5c;
+    Sha256 sha_outer;
+    sha_outer.update(pad, BLOCK_SIZE);
+    sha_outer.update(inner, DIGEST_SIZE);
+    sha_outer.finish(digest);
+}
+
+bool onyx::Sha256::equal(const unsigned char * a, const unsigned char * b, size_t size) {
+    unsigned char diff = 0;
+    for (size_t i = 0; i < size; i++)
+        diff |= a[i] ^ b[i];
+    return diff == 0;
+}
@@ -0,0 +1,54 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <cstdint>
+#include <cstddef>
+#include <boost/utility/string_view.hpp>
+
+namespace onyx {
+
+    /*
+     * SHA-256 (FIPS 180-4) and HMAC-SHA256 (RFC 2104), onyx links no crypto library
+     */
+    class Sha256 {
+    public:
+
+        static const size_t DIGEST_SIZE = 32;
+        static const size_t BLOCK_SIZE = 64;
+
+    private:
+
+        uint32_t m_state[8];
+        uint64_t m_length;
+        unsigned char m_block[BLOCK_SIZE];
+        size_t m_block_size;
+
+        void transform(const unsigned char * block);
+
+    public:
+
+        Sha256();
+
+        void update(const void * data, size_t size);
+
+        void update(boost::string_view data) {
+            update(data.data(), data.size());
+        }
+
+        /*
+         * the object can't be updated afterwards
+         */
+        void finish(unsigned char digest[DIGEST_SIZE]);
+
+        static void hash(boost::string_view data, unsigned char digest[DIGEST_SIZE]);
+
+        static void hmac(boost::string_view key, boost::string_view message, unsigned char digest[DIGEST_SIZE]);
+
+        /*
+         * comparison taking the same time wherever the digests differ
+         */
+        static bool equal(const unsigned char * a, const unsigned char * b, size_t size);
+    };
+}
+
+#endif
@@ -0,0 +1,75 @@
+#include "SignedSession.h"
+#include <cstdlib>
+
+namespace {
+
+    const char VERSION = '1';
+
+    /*
+     * next field of the payload, fields are separated by '\0'
+     */
+    bool field(boost::string_view & payload, boost::string_view & value) {
+        if (payload.empty())
+            return false;
+        size_t end = payload.find('\0');
+        value = payload.substr(0, end);
+        payload.remove_prefix(end == boost::string_view::npos ? payload.size() : end + 1);
+        return true;
+    }
+}
+
+onyx::SignedSession::SignedSession(const std::string & key) : m_key(key) {
+    if (key.size() < 32)
+        throw onyx::Exception("Session signing key must be at least 32 bytes");
+}
+
+std::string onyx::SignedSession::encode(const std::string & id, const std::string & token, const onyx::session::User & user, time_t expires) const {
+    std::string payload;
+    payload += VERSION;
+    payload += '\0';
+    payload += std::to_string(static_cast<long long> (expires));
+    for (const std::string & value : {id, token, user.getId(), user.getRole()}) {
+        if (value.find('\0') != std::string::npos)
+            throw onyx::Exception("Signed session fields can't contain '\\0'");
+        payload += '\0';
+        payload += value;
+    }
+    std::string cookie = onyx::utils::base64url_encode(payload);
+    unsigned char signature[Sha256::DIGEST_SIZE];
+    Sha256::hmac(m_key, cookie, signature);
+    size_t size = cookie.size();
+    cookie.resize(size + 1 + onyx::utils::base64url_size(Sha256::DIGEST_SIZE));
+    cookie[size] = '.';
+    onyx::utils::base64url_encode(signature, Sha256::DIGEST_SIZE, &cookie[size + 1]);
+    return cookie;
+}
+
+std::shared_ptr<const onyx::Session> onyx::SignedSession::decode(boost::string_view cookie, time_t now, time_t * expires) const {
+    size_t dot = cookie.rfind('.');
+    if (dot == boost::string_view::npos)
+        return nullptr;
+    boost::string_view encoded = cookie.substr(0, dot);
+    std::string signature;
+    if (!onyx::utils::base64url_decode(cookie.substr(dot + 1), signature) || signature.size() != Sha256::DIGEST_SIZE)
+        return nullptr;
+    unsigned char expected[Sha256::DIGEST_SIZE];
+    Sha256::hmac(m_key, encoded, expected);
+    if (!Sha256::equal(expected, reinterpret_cast<const unsigned char *> (signature.data()), Sha256::DIGEST_SIZE))
+        return nullptr;
+    std::string decoded;
+    if (!onyx::utils::base64url_decode(encoded, decoded))
+        return nullptr;
+    boost::string_view payload(decoded);
+    boost::string_view version, expiry, id, token, user_id, role;
+    if (!field(payload, version) || version.size() != 1 || version[0] != VERSION)
+        return nullptr;
+    if (!field(payload, expiry) || !field(payload, id) || !field(payload, token) || !field(payload, user_id))
+        return nullptr;
+    field(payload, role);
+    time_t expiry_time = static_cast<time_t> (strtoll(expiry.to_string().c_str(), nullptr, 10));
+    if (expiry_time <= now)
+        return nullptr;
+    if (expires != nullptr)
+        *expires = expiry_time;
+    return std::make_shared<const Session>(id.to_string(), token.to_string(), onyx::session::User(user_id.to_string(), role.to_string()));
+}
@@ -0,0 +1,44 @@
+#ifndef SIGNEDSESSION_H
+#define SIGNEDSESSION_H
+
+#include <string>
+#include <memory>
+#include <ctime>
+#include <boost/utility/string_view.hpp>
+#include "../session/Session.h"
+#include "../exception/Exception.h"
+#include "../common/utils.h"
+#include "Sha256.h"
+
+namespace onyx {
+
+    /*
+     * Session carried by the cookie itself: id, CSRF token, user id, role and expiry signed with HMAC-SHA256.
+     * The cookie is base64url(payload) "." base64url(signature), checking it needs no storage.
+     * The payload is signed but not encrypted, the client can read it
+     */
+    class SignedSession {
+    private:
+        std::string m_key;
+
+    public:
+
+        /*
+         * Throws onyx::Exception for a key shorter than 32 bytes
+         */
+        explicit SignedSession(const std::string & key);
+
+        /*
+         * cookie value of the session, id, token and the user fields can't contain '\0'
+         */
+        std::string encode(const std::string & id, const std::string & token, const onyx::session::User & user, time_t expires) const;
+
+        /*
+         * session of the cookie, nullptr when the signature doesn't match, the cookie is malformed
+         * or has expired by now. expires gets the expiry of a valid cookie
+         */
+        std::shared_ptr<const Session> decode(boost::string_view cookie, time_t now, time_t * expires = nullptr) const;
+    };
+}
+
+#endif
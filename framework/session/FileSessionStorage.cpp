@@ -0,0 +1,348 @@
+#include "FileSessionStorage.h"
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+const uint32_t onyx::FileSessionStorage::VERSION;
+const uint32_t onyx::FileSessionStorage::STRIPES;
+const size_t onyx::FileSessionStorage::ID_SIZE;
+const size_t onyx::FileSessionStorage::ROLE_SIZE;
+const size_t onyx::FileSessionStorage::BOOT_ID_SIZE;
+
+namespace {
+
+    const char MAGIC[8] = {'O', 'N', 'Y', 'X', 'S', 'E', 'S', 'S'};
+
+    /*
+     * copy a string with its terminating zero, false when it doesn't fit
+     */
+    bool copy(char * destination, size_t size, const std::string & source) {
+        if (source.size() >= size)
+            return false;
+        memcpy(destination, source.c_str(), source.size() + 1);
+        return true;
+    }
+}
+
+onyx::FileSessionStorage::FileSessionStorage(const std::string & path, size_t capacity, std::chrono::seconds ttl) :
+m_path(path), m_fd(-1), m_data(nullptr), m_size(0), m_ttl(ttl.count()) {
+    m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (m_fd < 0)
+        throw onyx::Exception("Can't open session file " + path + ": " + strerror(errno));
+    // the first process creates the file, the others wait for it
+    flock(m_fd, LOCK_EX);
+    try {
+        struct stat st;
+        if (fstat(m_fd, &st) != 0)
+            throw onyx::Exception("Can't stat session file " + path + ": " + strerror(errno));
+        Header header;
+        bool valid = static_cast<size_t>(st.st_size) >= sizeof (Header) &&
+                pread(m_fd, &header, sizeof (Header), 0) == sizeof (Header) &&
+                memcmp(header.m_magic, MAGIC, sizeof (MAGIC)) == 0;
+        if (valid) {
+            if (header.m_version != VERSION || header.m_stripes != STRIPES)
+                throw onyx::Exception("Unsupported session file " + path);
+            map(header.m_stripe_slots);
+            if (static_cast<size_t>(st.st_size) != m_size)
+                throw onyx::Exception("Truncated session file " + path);
+            char boot_id[BOOT_ID_SIZE];
+            readBootId(boot_id);
+            if (boot_id[0] != '\0' && strncmp(boot_id, m_header->m_boot_id, BOOT_ID_SIZE) != 0)
+                recover(boot_id);
+        } else {
+            // keep the load factor under 3/4
+            uint64_t stripe_slots = (capacity * 4 / 3 + STRIPES - 1) / STRIPES;
+            initialize(stripe_slots < 4 ? 4 : stripe_slots);
+        }
+    } catch (...) {
+        if (m_data != nullptr)
+            munmap(m_data, m_size);
+        flock(m_fd, LOCK_UN);
+        close(m_fd);
+        throw;
+    }
+    flock(m_fd, LOCK_UN);
+}
+
+onyx::FileSessionStorage::~FileSessionStorage() {
+    munmap(m_data, m_size);
+    close(m_fd);
+}
+
+void onyx::FileSessionStorage::map(uint64_t stripe_slots) {
+    m_stripe_slots = stripe_slots;
+    m_size = sizeof (Header) + STRIPES * sizeof (Stripe) + STRIPES * stripe_slots * sizeof (Slot);
+    void * data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (data == MAP_FAILED)
+        throw onyx::Exception("Can't map session file " + m_path + ": " + strerror(errno));
+    m_data = data;
+    m_header = static_cast<Header *> (m_data);
+    m_stripes = reinterpret_cast<Stripe *> (static_cast<char *> (m_data) + sizeof (Header));
+    m_slots = reinterpret_cast<Slot *> (m_stripes + STRIPES);
+}
+
+void onyx::FileSessionStorage::initialize(uint64_t stripe_slots) {
+    size_t size = sizeof (Header) + STRIPES * sizeof (Stripe) + STRIPES * stripe_slots * sizeof (Slot);
+    // truncating to zero first drops whatever an interrupted initialization left
+    if (ftruncate(m_fd, 0) != 0 || ftruncate(m_fd, size) != 0)
+        throw onyx::Exception("Can't resize session file " + m_path + ": " + strerror(errno));
+    map(stripe_slots);
+    m_header->m_version = VERSION;
+    m_header->m_stripes = STRIPES;
+    m_header->m_stripe_slots = stripe_slots;
+    readBootId(m_header->m_boot_id);
+    initializeMutexes();
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        m_stripes[i].m_used = 0;
+        m_stripes[i].m_last_purge = 0;
+    }
+    // the magic is written last, a file without it is initialized again
+    memcpy(m_header->m_magic, MAGIC, sizeof (MAGIC));
+    msync(m_data, sizeof (Header), MS_SYNC);
+}
+
+void onyx::FileSessionStorage::initializeMutexes() {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        pthread_mutex_init(&m_stripes[i].m_mutex, &attr);
+        m_stripes[i].m_locked = 0;
+    }
+    pthread_mutexattr_destroy(&attr);
+}
+
+void onyx::FileSessionStorage::recover(const char * boot_id) {
+    // no process of this boot uses the file yet, the flock keeps the others out
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        if (m_stripes[i].m_locked) {
+            LOGE << "Session file " << m_path << ": stripe " << i << " was locked when the host went down, its sessions are dropped";
+            memset(stripeSlots(i), 0, m_stripe_slots * sizeof (Slot));
+            m_stripes[i].m_used = 0;
+        }
+    }
+    initializeMutexes();
+    memcpy(m_header->m_boot_id, boot_id, BOOT_ID_SIZE);
+    msync(m_data, m_size, MS_SYNC);
+}
+
+void onyx::FileSessionStorage::readBootId(char * boot_id) {
+    memset(boot_id, 0, BOOT_ID_SIZE);
+    int fd = open("/proc/sys/kernel/random/boot_id", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    ssize_t size = read(fd, boot_id, BOOT_ID_SIZE - 1);
+    close(fd);
+    if (size <= 0) {
+        boot_id[0] = '\0';
+        return;
+    }
+    if (boot_id[size - 1] == '\n')
+        boot_id[size - 1] = '\0';
+}
+
+uint64_t onyx::FileSessionStorage::hash(const char * id, size_t size) {
+    // FNV-1a, stable across builds since the slots are stored in the file
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<unsigned char> (id[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool onyx::FileSessionStorage::lock(uint32_t stripe) {
+    int rc = pthread_mutex_lock(&m_stripes[stripe].m_mutex);
+    if (rc == EOWNERDEAD) {
+        LOGE << "Session file " << m_path << ": a process died holding stripe " << stripe << ", its sessions are dropped";
+        memset(stripeSlots(stripe), 0, m_stripe_slots * sizeof (Slot));
+        m_stripes[stripe].m_used = 0;
+        pthread_mutex_consistent(&m_stripes[stripe].m_mutex);
+        m_stripes[stripe].m_locked = 1;
+        return true;
+    }
+    if (rc != 0) {
+        LOGE << "Session file " << m_path << ": can't lock stripe " << stripe << ": " << strerror(rc);
+        return false;
+    }
+    m_stripes[stripe].m_locked = 1;
+    return true;
+}
+
+void onyx::FileSessionStorage::unlock(uint32_t stripe) {
+    m_stripes[stripe].m_locked = 0;
+    pthread_mutex_unlock(&m_stripes[stripe].m_mutex);
+}
+
+uint64_t onyx::FileSessionStorage::find(uint32_t stripe, uint64_t home, const char * id) const {
+    Slot * slots = stripeSlots(stripe);
+    for (uint64_t i = 0; i < m_stripe_slots; i++) {
+        uint64_t index = (home + i) % m_stripe_slots;
+        if (slots[index].m_state == EMPTY || strcmp(slots[index].m_id, id) == 0)
+            return index;
+    }
+    return m_stripe_slots;
+}
+
+void onyx::FileSessionStorage::erase(uint32_t stripe, uint64_t index) {
+    Slot * slots = stripeSlots(stripe);
+    uint64_t hole = index;
+    uint64_t next = index;
+    for (;;) {
+        slots[hole].m_state = EMPTY;
+        for (;;) {
+            next = (next + 1) % m_stripe_slots;
+            if (slots[next].m_state == EMPTY) {
+                m_stripes[stripe].m_used--;
+                return;
+            }
+            uint64_t home = hash(slots[next].m_id, strlen(slots[next].m_id)) / STRIPES % m_stripe_slots;
+            // the entry stays when its home lies cyclically in (hole, next]
+            bool stays = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+            if (!stays)
+                break;
+        }
+        slots[hole] = slots[next];
+        hole = next;
+    }
+}
+
+void onyx::FileSessionStorage::purge(uint32_t stripe, int64_t now) {
+    Slot * slots = stripeSlots(stripe);
+    uint64_t i = 0;
+    while (i < m_stripe_slots) {
+        // erase shifts a later entry into the slot, it is checked again
+        if (slots[i].m_state == USED && slots[i].m_expires <= now)
+            erase(stripe, i);
+        else
+            i++;
+    }
+    m_stripes[stripe].m_last_purge = now;
+}
+
+void onyx::FileSessionStorage::createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept {
+    createSession(id, token, onyx::session::User(user_id));
+}
+
+bool onyx::FileSessionStorage::createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept {
+    Slot slot;
+    memset(&slot, 0, sizeof (Slot));
+    if (!copy(slot.m_id, ID_SIZE, id) || !copy(slot.m_token, ID_SIZE, token) ||
+            !copy(slot.m_user_id, ID_SIZE, user.getId()) || !copy(slot.m_role, ROLE_SIZE, user.getRole())) {
+        LOGE << "Session file " << m_path << ": a session doesn't fit in a slot";
+        return false;
+    }
+    int64_t now = time(NULL);
+    slot.m_expires = now + m_ttl;
+    slot.m_state = USED;
+    uint64_t h = hash(id.data(), id.size());
+    uint32_t stripe = h % STRIPES;
+    uint64_t home = h / STRIPES % m_stripe_slots;
+    if (!lock(stripe))
+        return false;
+    Stripe & s = m_stripes[stripe];
+    uint64_t index = find(stripe, home, slot.m_id);
+    bool exists = index < m_stripe_slots && stripeSlots(stripe)[index].m_state == USED;
+    if (!exists && s.m_used >= m_stripe_slots * 3 / 4) {
+        // expired sessions are dropped at most once a second per stripe
+        if (s.m_last_purge < now)
+            purge(stripe, now);
+        if (s.m_used >= m_stripe_slots * 3 / 4) {
+            unlock(stripe);
+            LOGE << "Session file " << m_path << " is full, a session isn't stored";
+            return false;
+        }
+        index = find(stripe, home, slot.m_id);
+    }
+    if (index >= m_stripe_slots) {
+        unlock(stripe);
+        LOGE << "Session file " << m_path << " is full, a session isn't stored";
+        return false;
+    }
+    stripeSlots(stripe)[index] = slot;
+    if (!exists)
+        s.m_used++;
+    unlock(stripe);
+    return true;
+}
+
+onyx::Session * onyx::FileSessionStorage::fetchSession(const std::string & id) noexcept {
+    if (id.size() >= ID_SIZE)
+        return nullptr;
+    uint64_t h = hash(id.data(), id.size());
+    uint32_t stripe = h % STRIPES;
+    if (!lock(stripe))
+        return nullptr;
+    uint64_t index = find(stripe, h / STRIPES % m_stripe_slots, id.c_str());
+    Session * session = nullptr;
+    if (index < m_stripe_slots) {
+        Slot & slot = stripeSlots(stripe)[index];
+        if (slot.m_state == USED) {
+            if (slot.m_expires <= time(NULL))
+                erase(stripe, index);
+            else
+                session = new Session(id, slot.m_token, onyx::session::User(slot.m_user_id, slot.m_role));
+        }
+    }
+    unlock(stripe);
+    return session;
+}
+
+void onyx::FileSessionStorage::removeSession(const std::string & id) noexcept {
+    if (id.size() >= ID_SIZE)
+        return;
+    uint64_t h = hash(id.data(), id.size());
+    uint32_t stripe = h % STRIPES;
+    if (!lock(stripe))
+        return;
+    uint64_t index = find(stripe, h / STRIPES % m_stripe_slots, id.c_str());
+    if (index < m_stripe_slots && stripeSlots(stripe)[index].m_state == USED)
+        erase(stripe, index);
+    unlock(stripe);
+}
+
+void onyx::FileSessionStorage::clearAllSession() noexcept {
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        if (!lock(i))
+            continue;
+        memset(stripeSlots(i), 0, m_stripe_slots * sizeof (Slot));
+        m_stripes[i].m_used = 0;
+        unlock(i);
+    }
+}
+
+bool onyx::FileSessionStorage::enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept {
+    int64_t now = time(NULL);
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        if (!lock(i))
+            return false;
+        Slot * slots = stripeSlots(i);
+        for (uint64_t j = 0; j < m_stripe_slots; j++) {
+            if (slots[j].m_state == USED && slots[j].m_expires > now)
+                callback(slots[j].m_id);
+        }
+        unlock(i);
+    }
+    return true;
+}
+
+size_t onyx::FileSessionStorage::size() {
+    size_t size = 0;
+    for (uint32_t i = 0; i < STRIPES; i++) {
+        if (!lock(i))
+            continue;
+        size += m_stripes[i].m_used;
+        unlock(i);
+    }
+    return size;
+}
+
+size_t onyx::FileSessionStorage::getCapacity() const {
+    return STRIPES * (m_stripe_slots * 3 / 4);
+}
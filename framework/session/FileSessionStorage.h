@@ -0,0 +1,150 @@
+#ifndef FILESESSIONSTORAGE_H
+#define FILESESSIONSTORAGE_H
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <pthread.h>
+#include "Session.h"
+#include "../exception/Exception.h"
+#include "../common/plog/Log.h"
+
+namespace onyx {
+
+    /*
+     * Sessions kept in a memory-mapped file, they survive restarts and are shared by every worker process
+     * opening the same file. The file is a hash table with linear probing split into stripes, each locked by
+     * a process-shared robust mutex: when a process dies holding the lock, the sessions of its stripe are
+     * dropped instead of trusting a half-written table. The file records the boot it was last opened in: the
+     * first process of a new boot initializes the mutexes again, since a lock held when the host went down
+     * would never be released, and drops the stripes that were locked. The size is fixed when the file is created.
+     * Ids, tokens and user ids up to 63 bytes, role lists up to 255 bytes are stored, longer ones are rejected
+     * (Security refuses the login). Files of another version are rejected and must be removed.
+     * A session expires ttl after it was created (wall clock, so the expiry survives restarts too)
+     */
+    class FileSessionStorage : public ISessionStorage {
+    private:
+
+        static const uint32_t VERSION = 3;
+        static const uint32_t STRIPES = 64;
+        static const size_t ID_SIZE = 64;
+        static const size_t ROLE_SIZE = 256;
+        static const size_t BOOT_ID_SIZE = 40;
+
+        struct alignas(64) Header {
+            char m_magic[8];
+            uint32_t m_version;
+            uint32_t m_stripes;
+            uint64_t m_stripe_slots;
+            /*
+             * /proc/sys/kernel/random/boot_id of the last boot the file was opened in
+             */
+            char m_boot_id[BOOT_ID_SIZE];
+        };
+
+        struct alignas(64) Stripe {
+            pthread_mutex_t m_mutex;
+            /*
+             * set while the mutex is held
+             */
+            uint32_t m_locked;
+            uint64_t m_used;
+            int64_t m_last_purge;
+        };
+
+        enum SlotState : uint8_t {
+            EMPTY = 0,
+            USED = 1
+        };
+
+        struct Slot {
+            uint8_t m_state;
+            int64_t m_expires;
+            char m_id[ID_SIZE];
+            char m_token[ID_SIZE];
+            char m_user_id[ID_SIZE];
+            char m_role[ROLE_SIZE];
+        };
+
+        std::string m_path;
+        int m_fd;
+        void * m_data;
+        size_t m_size;
+        Header * m_header;
+        Stripe * m_stripes;
+        Slot * m_slots;
+        uint64_t m_stripe_slots;
+        int64_t m_ttl;
+
+        static uint64_t hash(const char * id, size_t size);
+
+        /*
+         * lock the stripe, a stripe left locked by a dead process is cleared
+         */
+        bool lock(uint32_t stripe);
+        void unlock(uint32_t stripe);
+
+        Slot * stripeSlots(uint32_t stripe) const {
+            return m_slots + stripe * m_stripe_slots;
+        }
+
+        /*
+         * slot of the id or of the empty slot ending its probe sequence, the stripe must be locked
+         */
+        uint64_t find(uint32_t stripe, uint64_t home, const char * id) const;
+        /*
+         * empty the slot shifting the following entries back, the table stays free of tombstones
+         */
+        void erase(uint32_t stripe, uint64_t index);
+        /*
+         * erase the expired sessions of the stripe
+         */
+        void purge(uint32_t stripe, int64_t now);
+        void map(uint64_t stripe_slots);
+        void initialize(uint64_t stripe_slots);
+        void initializeMutexes();
+        /*
+         * after a reboot: new mutexes, the stripes locked when the host went down are dropped
+         */
+        void recover(const char * boot_id);
+        static void readBootId(char * boot_id);
+
+    public:
+
+        /*
+         * open the file or create it with room for capacity sessions.
+         * Throws onyx::Exception when the file can't be created or isn't a session file
+         */
+        FileSessionStorage(const std::string & path, size_t capacity = 1 << 20, std::chrono::seconds ttl = std::chrono::seconds(60 * 60 * 24 * 30));
+
+        virtual ~FileSessionStorage();
+
+        FileSessionStorage(const FileSessionStorage &) = delete;
+        FileSessionStorage & operator=(const FileSessionStorage &) = delete;
+
+        virtual void createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept override;
+
+        virtual bool createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept override;
+
+        virtual Session * fetchSession(const std::string & id) noexcept override;
+
+        virtual void removeSession(const std::string & id) noexcept override;
+
+        virtual void clearAllSession() noexcept override;
+
+        virtual bool enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept override;
+
+        virtual bool isShared() const noexcept override {
+            return true;
+        }
+
+        /*
+         * sessions stored in the file, expired ones included
+         */
+        size_t size();
+
+        size_t getCapacity() const;
+    };
+}
+
+#endif
@@ -0,0 +1,121 @@
+#include "MemorySessionStorage.h"
+#include <algorithm>
+
+const size_t onyx::MemorySessionStorage::WHEEL_SIZE;
+
+onyx::MemorySessionStorage::MemorySessionStorage(std::chrono::seconds ttl, size_t shards) :
+m_shards(shards == 0 ? 1 : shards), m_ttl(ttl.count() > 0 ? ttl.count() : 0) {
+    uint64_t tick = now();
+    for (auto & s : m_shards)
+        s.m_tick = tick;
+}
+
+uint64_t onyx::MemorySessionStorage::now() {
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void onyx::MemorySessionStorage::advance(Shard & s, uint64_t now) {
+    if (now <= s.m_tick)
+        return;
+    // after a pause longer than the wheel every slot is swept once
+    uint64_t steps = now - s.m_tick;
+    if (steps > WHEEL_SIZE)
+        steps = WHEEL_SIZE;
+    for (uint64_t i = 1; i <= steps; i++) {
+        size_t index = (s.m_tick + i) % WHEEL_SIZE;
+        std::vector<std::string> & slot = s.m_wheel[index];
+        size_t kept = 0;
+        for (size_t j = 0; j < slot.size(); j++) {
+            auto it = s.m_records.find(slot[j]);
+            if (it == s.m_records.end() || it->second.m_expires % WHEEL_SIZE != index)
+                continue;
+            if (it->second.m_expires <= now) {
+                s.m_records.erase(it);
+                continue;
+            }
+            // expires on a later turn of the wheel
+            if (kept != j)
+                slot[kept] = std::move(slot[j]);
+            kept++;
+        }
+        slot.resize(kept);
+    }
+    s.m_tick = now;
+}
+
+void onyx::MemorySessionStorage::createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept {
+    createSession(id, token, onyx::session::User(user_id));
+}
+
+bool onyx::MemorySessionStorage::createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept {
+    Shard & s = shard(id);
+    uint64_t tick = now();
+    uint64_t expires = tick + m_ttl;
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    advance(s, tick);
+    Record record = {token, user.getId(), user.getRole(), expires};
+    auto inserted = s.m_records.emplace(id, record);
+    // a session created again in the same slot is listed already, the sweep of another old slot skips it
+    bool listed = !inserted.second && inserted.first->second.m_expires % WHEEL_SIZE == expires % WHEEL_SIZE;
+    if (!inserted.second)
+        inserted.first->second = std::move(record);
+    if (!listed)
+        s.m_wheel[expires % WHEEL_SIZE].push_back(id);
+    return true;
+}
+
+onyx::Session * onyx::MemorySessionStorage::fetchSession(const std::string & id) noexcept {
+    Shard & s = shard(id);
+    uint64_t tick = now();
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    advance(s, tick);
+    auto it = s.m_records.find(id);
+    if (it == s.m_records.end() || it->second.m_expires <= tick)
+        return nullptr;
+    return new Session(id, it->second.m_token, onyx::session::User(it->second.m_user_id, it->second.m_role));
+}
+
+void onyx::MemorySessionStorage::removeSession(const std::string & id) noexcept {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    auto it = s.m_records.find(id);
+    if (it == s.m_records.end())
+        return;
+    // a session created again in the slot would be listed twice otherwise
+    std::vector<std::string> & slot = s.m_wheel[it->second.m_expires % WHEEL_SIZE];
+    auto listed = std::find(slot.begin(), slot.end(), id);
+    if (listed != slot.end()) {
+        *listed = std::move(slot.back());
+        slot.pop_back();
+    }
+    s.m_records.erase(it);
+}
+
+void onyx::MemorySessionStorage::clearAllSession() noexcept {
+    for (auto & s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.m_mutex);
+        s.m_records.clear();
+        for (auto & slot : s.m_wheel)
+            slot.clear();
+    }
+}
+
+bool onyx::MemorySessionStorage::enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept {
+    uint64_t tick = now();
+    for (auto & s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.m_mutex);
+        advance(s, tick);
+        for (auto & record : s.m_records)
+            callback(record.first);
+    }
+    return true;
+}
+
+size_t onyx::MemorySessionStorage::size() {
+    size_t size = 0;
+    for (auto & s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.m_mutex);
+        size += s.m_records.size();
+    }
+    return size;
+}
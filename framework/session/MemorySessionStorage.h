@@ -0,0 +1,82 @@
+#ifndef MEMORYSESSIONSTORAGE_H
+#define MEMORYSESSIONSTORAGE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include "Session.h"
+
+namespace onyx {
+
+    /*
+     * Sessions kept in the memory of the process, lost on restart. Ids are spread over shards, each with
+     * its own lock. A session expires ttl after it was created: every shard has a timer wheel with one slot
+     * per second, the slots passed since the last call are swept by the next call on the shard
+     */
+    class MemorySessionStorage : public ISessionStorage {
+    private:
+
+        static const size_t WHEEL_SIZE = 256;
+
+        struct Record {
+            std::string m_token;
+            std::string m_user_id;
+            std::string m_role;
+            /*
+             * seconds of the steady clock
+             */
+            uint64_t m_expires;
+        };
+
+        struct alignas(64) Shard {
+            std::mutex m_mutex;
+            std::unordered_map<std::string, Record> m_records;
+            /*
+             * ids by expiry second modulo WHEEL_SIZE. A session is listed once in the slot of its expiry,
+             * the copy left in an older slot by a session created again is dropped when that slot is swept
+             */
+            std::vector<std::string> m_wheel[WHEEL_SIZE];
+            uint64_t m_tick = 0;
+        };
+
+        std::vector<Shard> m_shards;
+        uint64_t m_ttl;
+
+        Shard & shard(const std::string & id) {
+            return m_shards[std::hash<std::string>()(id) % m_shards.size()];
+        }
+
+        static uint64_t now();
+
+        /*
+         * remove the sessions expired by now, the shard must be locked
+         */
+        void advance(Shard & s, uint64_t now);
+
+    public:
+
+        MemorySessionStorage(std::chrono::seconds ttl = std::chrono::seconds(60 * 60 * 24 * 30), size_t shards = 16);
+
+        virtual void createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept override;
+
+        virtual bool createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept override;
+
+        virtual Session * fetchSession(const std::string & id) noexcept override;
+
+        virtual void removeSession(const std::string & id) noexcept override;
+
+        virtual void clearAllSession() noexcept override;
+
+        virtual bool enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept override;
+
+        /*
+         * sessions not swept yet, expired ones included
+         */
+        size_t size();
+    };
+}
+
+#endif
@@ -1 +1,12 @@
-#include "Session.h"
\ No newline at end of file
+#include "Session.h"
+#include "../security/RoleRegistry.h"
+
+uint64_t onyx::Session::getRoleMask() const {
+    if (m_role_mask_resolved.load(std::memory_order_acquire))
+        return m_role_mask.load(std::memory_order_relaxed);
+    // concurrent first calls resolve the same mask
+    uint64_t mask = onyx::RoleRegistry::getInstance()->resolve(m_user.getRole());
+    m_role_mask.store(mask, std::memory_order_relaxed);
+    m_role_mask_resolved.store(true, std::memory_order_release);
+    return mask;
+}
@@ -8,6 +8,11 @@
 #include <map>
 #include <thread>
 #include <mutex>
+#include <vector>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <cstdint>
 
 namespace onyx {
 
@@ -26,10 +31,27 @@ namespace onyx {
                 return m_id;
             }
 
+            /*
+                a user with several roles has them separated by commas, e.g. "admin,editor"
+             */
             std::string getRole() const {
                 return m_role;
             }
 
+            std::vector<std::string> getRoles() const {
+                std::vector<std::string> roles;
+                size_t begin = 0;
+                while (begin < m_role.size()) {
+                    size_t end = m_role.find(',', begin);
+                    if (end == std::string::npos)
+                        end = m_role.size();
+                    if (end > begin)
+                        roles.push_back(m_role.substr(begin, end - begin));
+                    begin = end + 1;
+                }
+                return roles;
+            }
+
         };
 
     }
@@ -44,6 +66,8 @@ namespace onyx {
         std::string m_id;
         std::string m_token;
         onyx::session::User m_user;
+        mutable std::atomic<uint64_t> m_role_mask;
+        mutable std::atomic<bool> m_role_mask_resolved;
 
     public:
         
@@ -54,7 +78,10 @@ namespace onyx {
             \param[in] user - объект связанного пользователя
             \warning Пользователь с пустый ID считается обыкновенным пользователем
         */
-        Session(const std::string & id, const std::string & token, onyx::session::User user) : m_id(id), m_token(token), m_user(user) {
+        Session(const std::string & id, const std::string & token, onyx::session::User user) : m_id(id), m_token(token), m_user(user), m_role_mask(0), m_role_mask_resolved(false) {
+        }
+
+        Session(const Session & session) : m_id(session.m_id), m_token(session.m_token), m_user(session.m_user), m_role_mask(0), m_role_mask_resolved(false) {
         }
 
         /**
@@ -81,6 +108,10 @@ namespace onyx {
             return m_id;
         }
 
+        /*
+            roles of the user as onyx::RoleRegistry bits, resolved on the first call
+         */
+        uint64_t getRoleMask() const;
 
     };
 
@@ -93,6 +124,10 @@ namespace onyx {
 
     class ISessionStorage {
     public:
+
+        virtual ~ISessionStorage() {
+        }
+
         /**
          Создание сессии и помещение ее в хранилище (например БД)
          \param[in] id - индентификатор сессии
@@ -100,6 +135,14 @@ namespace onyx {
          \param[in] user_id - идентификатор связанного с сессией пользователя
          */
         virtual void createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept = 0;
+        /*
+            called by onyx::Security on login, storages keeping the role of the user override it.
+            False when the session isn't stored (storage full, fields too long), the login is refused then
+         */
+        virtual bool createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept {
+            createSession(id, token, user.getId());
+            return true;
+        }
         /**
             Получение сесси из хранилища
             \param[in] id - индентификатор сессии
@@ -117,6 +160,52 @@ namespace onyx {
             \param[in] id - индентификатор сессии
          */
         virtual void clearAllSession() noexcept = 0;
+        /*
+            call callback with the id of every live session, false when the storage can't list its sessions.
+            The callback must not use the storage
+         */
+        virtual bool enumerateSessions(const std::function<void(const std::string & id)> & /*callback*/) noexcept {
+            return false;
+        }
+        /*
+            true when other processes create sessions in the storage too, Security then keeps no session filter
+         */
+        virtual bool isShared() const noexcept {
+            return false;
+        }
+    };
+
+    /*
+     * Storage answering lookups asynchronously and in batches, onyx::SyncSessionStorageAdapter
+     * turns an ISessionStorage into one. Security uses fetchSessions to coalesce the lookups of
+     * concurrent requests (see Security::setSessionBatching)
+     */
+    class ISessionStorageV2 : public ISessionStorage {
+    public:
+
+        typedef std::function<void(std::shared_ptr<const Session> session)> FetchCallback;
+
+        /*
+         * callback gets the session or nullptr, it may run on another thread or before the call returns
+         */
+        virtual void fetchSessionAsync(const std::string & id, FetchCallback callback) noexcept = 0;
+
+        /*
+         * sessions of count ids in the same order, nullptr for the unknown ones
+         */
+        virtual std::vector<std::shared_ptr<const Session>> fetchSessions(const std::string * ids, size_t count) noexcept = 0;
+
+        std::future<std::shared_ptr<const Session>> fetchSessionAsync(const std::string & id) {
+            std::shared_ptr<std::promise<std::shared_ptr<const Session>>> promise = std::make_shared<std::promise<std::shared_ptr<const Session>>>();
+            fetchSessionAsync(id, [promise](std::shared_ptr<const Session> session) {
+                promise->set_value(session);
+            });
+            return promise->get_future();
+        }
+
+        std::vector<std::shared_ptr<const Session>> fetchSessions(const std::vector<std::string> & ids) {
+            return fetchSessions(ids.data(), ids.size());
+        }
     };
 
 }
@@ -0,0 +1,46 @@
+#include "SessionBatcher.h"
+
+onyx::SessionBatcher::SessionBatcher(ISessionStorageV2 * storage, std::chrono::microseconds window, size_t max_batch) :
+m_storage(storage), m_window(window), m_max_batch(max_batch == 0 ? 1 : max_batch) {
+}
+
+std::shared_ptr<const onyx::Session> onyx::SessionBatcher::fetch(const std::string & id) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_open) {
+        // join the open batch, the same id is looked up once
+        std::shared_ptr<Batch> batch = m_open;
+        size_t index = 0;
+        while (index < batch->m_ids.size() && batch->m_ids[index] != id)
+            index++;
+        if (index == batch->m_ids.size()) {
+            batch->m_ids.push_back(id);
+            if (batch->m_ids.size() >= m_max_batch) {
+                // later lookups start a new batch
+                m_open.reset();
+                m_full.notify_all();
+            }
+        }
+        m_done.wait(lock, [&batch]() {
+            return batch->m_done;
+        });
+        return batch->m_sessions[index];
+    }
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+    batch->m_ids.push_back(id);
+    if (m_max_batch > 1) {
+        m_open = batch;
+        m_full.wait_for(lock, m_window, [this, &batch]() {
+            return m_open != batch;
+        });
+        if (m_open == batch)
+            m_open.reset();
+    }
+    lock.unlock();
+    std::vector<std::shared_ptr<const Session>> sessions = m_storage->fetchSessions(batch->m_ids.data(), batch->m_ids.size());
+    sessions.resize(batch->m_ids.size());
+    lock.lock();
+    batch->m_sessions = std::move(sessions);
+    batch->m_done = true;
+    m_done.notify_all();
+    return batch->m_sessions[0];
+}
@@ -0,0 +1,50 @@
+#ifndef SESSIONBATCHER_H
+#define SESSIONBATCHER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include "Session.h"
+
+namespace onyx {
+
+    /*
+     * Coalesces the session lookups of concurrent requests into ISessionStorageV2::fetchSessions calls.
+     * The first lookup of a batch waits up to window for others (or until max_batch ids are collected),
+     * then fetches them all at once while the next lookups start a new batch. No thread of its own
+     */
+    class SessionBatcher {
+    private:
+
+        struct Batch {
+            std::vector<std::string> m_ids;
+            std::vector<std::shared_ptr<const Session>> m_sessions;
+            bool m_done = false;
+        };
+
+        ISessionStorageV2 * m_storage;
+        std::chrono::microseconds m_window;
+        size_t m_max_batch;
+        std::mutex m_mutex;
+        std::condition_variable m_full;
+        std::condition_variable m_done;
+        /*
+         * batch collecting ids, nullptr when no lookup is waiting
+         */
+        std::shared_ptr<Batch> m_open;
+
+    public:
+
+        /*
+         * storage isn't owned, it must outlive this object
+         */
+        SessionBatcher(ISessionStorageV2 * storage, std::chrono::microseconds window, size_t max_batch = 64);
+
+        std::shared_ptr<const Session> fetch(const std::string & id);
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "SessionCache.h"
+
+onyx::SessionCache::SessionCache(size_t capacity, std::chrono::steady_clock::duration ttl, size_t shards) :
+m_shards(shards == 0 ? 1 : shards), m_ttl(ttl) {
+    m_shard_capacity = capacity / m_shards.size();
+    if (m_shard_capacity == 0)
+        m_shard_capacity = 1;
+}
+
+std::shared_ptr<const onyx::Session> onyx::SessionCache::get(const std::string & id) {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    auto it = s.m_index.find(id);
+    if (it == s.m_index.end()) {
+        s.m_misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    if (it->second->m_expires <= std::chrono::steady_clock::now()) {
+        s.m_entries.erase(it->second);
+        s.m_index.erase(it);
+        s.m_misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    s.m_entries.splice(s.m_entries.begin(), s.m_entries, it->second);
+    s.m_hits.fetch_add(1, std::memory_order_relaxed);
+    return it->second->m_session;
+}
+
+void onyx::SessionCache::put(const std::string & id, std::shared_ptr<const Session> session) {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    insert(s, id, session);
+}
+
+void onyx::SessionCache::insert(Shard & s, const std::string & id, std::shared_ptr<const Session> session) {
+    std::chrono::steady_clock::time_point expires = std::chrono::steady_clock::now() + m_ttl;
+    auto it = s.m_index.find(id);
+    if (it != s.m_index.end()) {
+        it->second->m_session = session;
+        it->second->m_expires = expires;
+        s.m_entries.splice(s.m_entries.begin(), s.m_entries, it->second);
+        return;
+    }
+    if (s.m_entries.size() >= m_shard_capacity) {
+        s.m_index.erase(s.m_entries.back().m_id);
+        s.m_entries.pop_back();
+    }
+    s.m_entries.push_front({id, session, expires});
+    s.m_index[id] = s.m_entries.begin();
+}
+
+uint64_t onyx::SessionCache::getRemovals(const std::string & id) {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    return s.m_removals;
+}
+
+void onyx::SessionCache::put(const std::string & id, std::shared_ptr<const Session> session, uint64_t removals) {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    if (s.m_removals == removals)
+        insert(s, id, session);
+}
+
+void onyx::SessionCache::remove(const std::string & id) {
+    Shard & s = shard(id);
+    std::lock_guard<std::mutex> lock(s.m_mutex);
+    s.m_removals++;
+    auto it = s.m_index.find(id);
+    if (it == s.m_index.end())
+        return;
+    s.m_entries.erase(it->second);
+    s.m_index.erase(it);
+}
+
+void onyx::SessionCache::clear() {
+    for (auto & s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.m_mutex);
+        s.m_removals++;
+        s.m_entries.clear();
+        s.m_index.clear();
+    }
+}
+
+size_t onyx::SessionCache::size() {
+    size_t size = 0;
+    for (auto & s : m_shards) {
+        std::lock_guard<std::mutex> lock(s.m_mutex);
+        size += s.m_entries.size();
+    }
+    return size;
+}
+
+uint64_t onyx::SessionCache::getHits() const {
+    uint64_t hits = 0;
+    for (auto & s : m_shards)
+        hits += s.m_hits.load(std::memory_order_relaxed);
+    return hits;
+}
+
+uint64_t onyx::SessionCache::getMisses() const {
+    uint64_t misses = 0;
+    for (auto & s : m_shards)
+        misses += s.m_misses.load(std::memory_order_relaxed);
+    return misses;
+}
@@ -0,0 +1,92 @@
+#ifndef SESSIONCACHE_H
+#define SESSIONCACHE_H
+
+#include <string>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include "Session.h"
+
+namespace onyx {
+
+    /*
+     * In-process cache of sessions in front of ISessionStorage. Ids are spread over shards, each with
+     * its own lock, LRU list and share of the capacity. Entries expire ttl after they were stored.
+     * Sessions are immutable and shared by the requests using them
+     */
+    class SessionCache {
+    private:
+
+        struct Entry {
+            std::string m_id;
+            std::shared_ptr<const Session> m_session;
+            std::chrono::steady_clock::time_point m_expires;
+        };
+
+        struct alignas(64) Shard {
+            std::mutex m_mutex;
+            /*
+             * most recently used first
+             */
+            std::list<Entry> m_entries;
+            std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+            std::atomic<uint64_t> m_hits{0};
+            std::atomic<uint64_t> m_misses{0};
+            /*
+             * removals from the shard, see put
+             */
+            uint64_t m_removals = 0;
+        };
+
+        std::vector<Shard> m_shards;
+        size_t m_shard_capacity;
+        std::chrono::steady_clock::duration m_ttl;
+
+        Shard & shard(const std::string & id) {
+            return m_shards[std::hash<std::string>()(id) % m_shards.size()];
+        }
+
+        /*
+         * the shard must be locked
+         */
+        void insert(Shard & s, const std::string & id, std::shared_ptr<const Session> session);
+
+    public:
+
+        SessionCache(size_t capacity, std::chrono::steady_clock::duration ttl, size_t shards = 16);
+
+        /*
+         * nullptr when the session isn't cached or has expired
+         */
+        std::shared_ptr<const Session> get(const std::string & id);
+
+        void put(const std::string & id, std::shared_ptr<const Session> session);
+
+        /*
+         * token for put: a session read from the storage after this call is cached only if no
+         * session of its shard was removed meanwhile, so a logout racing the read isn't undone
+         */
+        uint64_t getRemovals(const std::string & id);
+
+        /*
+         * put unless a session of the shard was removed since getRemovals returned removals
+         */
+        void put(const std::string & id, std::shared_ptr<const Session> session, uint64_t removals);
+
+        void remove(const std::string & id);
+
+        void clear();
+
+        size_t size();
+
+        uint64_t getHits() const;
+
+        uint64_t getMisses() const;
+    };
+}
+
+#endif
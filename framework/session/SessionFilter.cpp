@@ -0,0 +1,80 @@
+#include "SessionFilter.h"
+#include <cmath>
+
+onyx::SessionFilter::SessionFilter(size_t capacity, double false_positive_rate) : m_used(0), m_items(0) {
+    if (capacity == 0)
+        capacity = 1;
+    if (false_positive_rate <= 0 || false_positive_rate >= 1)
+        false_positive_rate = 0.01;
+    double ln2 = std::log(2.0);
+    m_size = static_cast<size_t> (std::ceil(-static_cast<double> (capacity) * std::log(false_positive_rate) / (ln2 * ln2)));
+    if (m_size < 64)
+        m_size = 64;
+    m_hashes = static_cast<size_t> (std::round(static_cast<double> (m_size) / capacity * ln2));
+    if (m_hashes == 0)
+        m_hashes = 1;
+    m_counters.reset(new std::atomic<uint8_t>[m_size]);
+    for (size_t i = 0; i < m_size; i++)
+        m_counters[i].store(0, std::memory_order_relaxed);
+}
+
+template<typename Function>
+void onyx::SessionFilter::forEachIndex(boost::string_view id, Function function) const {
+    // double hashing: index i is h1 + i * h2
+    uint64_t h1 = 14695981039346656037ULL;
+    for (char ch : id) {
+        h1 ^= static_cast<unsigned char> (ch);
+        h1 *= 1099511628211ULL;
+    }
+    uint64_t h2 = h1 + 0x9e3779b97f4a7c15ULL;
+    h2 = (h2 ^ (h2 >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h2 = (h2 ^ (h2 >> 27)) * 0x94d049bb133111ebULL;
+    h2 = (h2 ^ (h2 >> 31)) | 1;
+    for (size_t i = 0; i < m_hashes; i++) {
+        if (!function((h1 + i * h2) % m_size))
+            return;
+    }
+}
+
+void onyx::SessionFilter::add(boost::string_view id) {
+    forEachIndex(id, [this](size_t index) {
+        uint8_t counter = m_counters[index].load(std::memory_order_relaxed);
+        do {
+            if (counter == UINT8_MAX)
+                return true;
+        } while (!m_counters[index].compare_exchange_weak(counter, counter + 1, std::memory_order_relaxed));
+        if (counter == 0)
+            m_used.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    });
+    m_items.fetch_add(1, std::memory_order_relaxed);
+}
+
+void onyx::SessionFilter::remove(boost::string_view id) {
+    forEachIndex(id, [this](size_t index) {
+        uint8_t counter = m_counters[index].load(std::memory_order_relaxed);
+        do {
+            if (counter == 0 || counter == UINT8_MAX)
+                return true;
+        } while (!m_counters[index].compare_exchange_weak(counter, counter - 1, std::memory_order_relaxed));
+        if (counter == 1)
+            m_used.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    });
+    if (m_items.load(std::memory_order_relaxed) > 0)
+        m_items.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool onyx::SessionFilter::contains(boost::string_view id) const {
+    bool found = true;
+    forEachIndex(id, [this, &found](size_t index) {
+        found = m_counters[index].load(std::memory_order_relaxed) != 0;
+        return found;
+    });
+    return found;
+}
+
+double onyx::SessionFilter::getFalsePositiveRate() const {
+    double used = static_cast<double> (m_used.load(std::memory_order_relaxed)) / m_size;
+    return std::pow(used, static_cast<double> (m_hashes));
+}
@@ -0,0 +1,67 @@
+#ifndef SESSIONFILTER_H
+#define SESSIONFILTER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+
+namespace onyx {
+
+    /*
+     * Counting Bloom filter of live session ids. contains() never misses an added id, so an id it
+     * rejects can't be in the storage; an id it accepts is in it with probability 1 - getFalsePositiveRate().
+     * Counters are 8 bits and lock-free, a saturated counter is never decremented again
+     */
+    class SessionFilter {
+    private:
+        std::unique_ptr<std::atomic<uint8_t>[]> m_counters;
+        size_t m_size;
+        size_t m_hashes;
+        std::atomic<size_t> m_used;
+        std::atomic<size_t> m_items;
+
+        /*
+         * call function with the k counter indexes of the id until it returns false
+         */
+        template<typename Function>
+        void forEachIndex(boost::string_view id, Function function) const;
+
+    public:
+
+        /*
+         * sized for capacity ids at the given false positive rate
+         */
+        SessionFilter(size_t capacity, double false_positive_rate = 0.01);
+
+        void add(boost::string_view id);
+
+        /*
+         * the id must have been added, removing an unknown id may hide others
+         */
+        void remove(boost::string_view id);
+
+        bool contains(boost::string_view id) const;
+
+        /*
+         * estimated from the share of non-zero counters
+         */
+        double getFalsePositiveRate() const;
+
+        size_t getItems() const {
+            return m_items.load(std::memory_order_relaxed);
+        }
+
+        size_t getSize() const {
+            return m_size;
+        }
+
+        size_t getHashes() const {
+            return m_hashes;
+        }
+    };
+}
+
+#endif
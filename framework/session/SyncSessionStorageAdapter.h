@@ -0,0 +1,73 @@
+#ifndef SYNCSESSIONSTORAGEADAPTER_H
+#define SYNCSESSIONSTORAGEADAPTER_H
+
+#include "Session.h"
+
+namespace onyx {
+
+    /*
+     * ISessionStorageV2 over a synchronous ISessionStorage: fetchSessionAsync runs the callback before
+     * returning and fetchSessions looks the ids up one by one
+     */
+    class SyncSessionStorageAdapter : public ISessionStorageV2 {
+    private:
+        ISessionStorage * m_storage;
+
+    public:
+
+        using ISessionStorageV2::fetchSessionAsync;
+        using ISessionStorageV2::fetchSessions;
+
+        /*
+         * storage isn't owned, it must outlive this object
+         */
+        explicit SyncSessionStorageAdapter(ISessionStorage * storage) : m_storage(storage) {
+        }
+
+        virtual void createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept override {
+            m_storage->createSession(id, token, user_id);
+        }
+
+        virtual bool createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept override {
+            return m_storage->createSession(id, token, user);
+        }
+
+        virtual Session * fetchSession(const std::string & id) noexcept override {
+            return m_storage->fetchSession(id);
+        }
+
+        virtual void removeSession(const std::string & id) noexcept override {
+            m_storage->removeSession(id);
+        }
+
+        virtual void clearAllSession() noexcept override {
+            m_storage->clearAllSession();
+        }
+
+        virtual bool enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept override {
+            return m_storage->enumerateSessions(callback);
+        }
+
+        virtual bool isShared() const noexcept override {
+            return m_storage->isShared();
+        }
+
+        virtual void fetchSessionAsync(const std::string & id, FetchCallback callback) noexcept override {
+            callback(std::shared_ptr<const Session>(m_storage->fetchSession(id)));
+        }
+
+        virtual std::vector<std::shared_ptr<const Session>> fetchSessions(const std::string * ids, size_t count) noexcept override {
+            std::vector<std::shared_ptr<const Session>> sessions;
+            sessions.reserve(count);
+            for (size_t i = 0; i < count; i++)
+                sessions.emplace_back(m_storage->fetchSession(ids[i]));
+            return sessions;
+        }
+
+        ISessionStorage * getStorage() const {
+            return m_storage;
+        }
+    };
+}
+
+#endif
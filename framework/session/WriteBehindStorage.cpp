@@ -0,0 +1,194 @@
+#include "WriteBehindStorage.h"
+
+onyx::WriteBehindStorage::WriteBehindStorage(ISessionStorage * storage, const Settings & settings) :
+m_storage(storage), m_storage_v2(dynamic_cast<ISessionStorageV2 *> (storage)), m_settings(settings) {
+    if (m_settings.batch_size == 0)
+        m_settings.batch_size = 1;
+    if (m_settings.max_pending < m_settings.batch_size)
+        m_settings.max_pending = m_settings.batch_size;
+    m_thread = std::thread(&WriteBehindStorage::run, this);
+}
+
+onyx::WriteBehindStorage::~WriteBehindStorage() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void onyx::WriteBehindStorage::run() {
+    std::vector<std::string> failed;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_wake.wait_for(lock, m_settings.flush_interval, [this]() {
+            return m_stop || m_urgent || m_pending.size() >= m_settings.batch_size;
+        });
+        m_urgent = false;
+        if (m_pending.empty()) {
+            if (m_stop)
+                return;
+            continue;
+        }
+        m_writing.swap(m_pending);
+        uint64_t batch = m_queued;
+        lock.unlock();
+        for (auto & write : m_writing) {
+            if (write.second.remove)
+                m_storage->removeSession(write.first);
+            else if (!m_storage->createSession(write.first, write.second.token, write.second.user) && m_settings.durability == Durability::SYNC)
+                failed.push_back(write.first);
+        }
+        lock.lock();
+        m_failed.insert(failed.begin(), failed.end());
+        failed.clear();
+        // fetchSession reads the storage from now on
+        m_writing.clear();
+        m_flushed = batch;
+        m_written.notify_all();
+    }
+}
+
+void onyx::WriteBehindStorage::enqueue(std::unique_lock<std::mutex> & lock, const std::string & id, Write && write, bool durable) {
+    m_written.wait(lock, [this]() {
+        return m_pending.size() < m_settings.max_pending;
+    });
+    m_pending[id] = std::move(write);
+    uint64_t queued = ++m_queued;
+    if (durable) {
+        m_urgent = true;
+        m_wake.notify_one();
+        m_written.wait(lock, [this, queued]() {
+            return m_flushed >= queued;
+        });
+    } else if (m_pending.size() >= m_settings.batch_size)
+        m_wake.notify_one();
+}
+
+void onyx::WriteBehindStorage::createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept {
+    createSession(id, token, onyx::session::User(user_id));
+}
+
+bool onyx::WriteBehindStorage::createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_settings.durability != Durability::SYNC) {
+        // a queued session counts as stored, a failed write is only logged by the storage
+        enqueue(lock, id, {false, token, user}, false);
+        return true;
+    }
+    enqueue(lock, id, {false, token, user}, true);
+    return m_failed.erase(id) == 0;
+}
+
+const onyx::WriteBehindStorage::Write * onyx::WriteBehindStorage::findWrite(const std::string & id) const {
+    auto it = m_pending.find(id);
+    if (it != m_pending.end())
+        return &it->second;
+    it = m_writing.find(id);
+    if (it != m_writing.end())
+        return &it->second;
+    return nullptr;
+}
+
+onyx::Session * onyx::WriteBehindStorage::fetchSession(const std::string & id) noexcept {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Write * write = findWrite(id);
+        if (write != nullptr)
+            return write->remove ? nullptr : new Session(id, write->token, write->user);
+    }
+    return m_storage->fetchSession(id);
+}
+
+void onyx::WriteBehindStorage::fetchSessionAsync(const std::string & id, FetchCallback callback) noexcept {
+    bool queued = false;
+    std::shared_ptr<const Session> session;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Write * write = findWrite(id);
+        if (write != nullptr) {
+            queued = true;
+            if (!write->remove)
+                session = std::make_shared<const Session>(id, write->token, write->user);
+        }
+    }
+    // the callback runs without the lock, it may use the storage
+    if (queued)
+        callback(session);
+    else if (m_storage_v2 != nullptr)
+        m_storage_v2->fetchSessionAsync(id, callback);
+    else
+        callback(std::shared_ptr<const Session>(m_storage->fetchSession(id)));
+}
+
+std::vector<std::shared_ptr<const onyx::Session>> onyx::WriteBehindStorage::fetchSessions(const std::string * ids, size_t count) noexcept {
+    std::vector<std::shared_ptr<const Session>> sessions(count);
+    std::vector<std::string> missing;
+    std::vector<size_t> missing_index;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < count; i++) {
+            const Write * write = findWrite(ids[i]);
+            if (write == nullptr) {
+                missing.push_back(ids[i]);
+                missing_index.push_back(i);
+            } else if (!write->remove)
+                sessions[i] = std::make_shared<const Session>(ids[i], write->token, write->user);
+        }
+    }
+    if (missing.empty())
+        return sessions;
+    if (m_storage_v2 != nullptr) {
+        std::vector<std::shared_ptr<const Session>> found = m_storage_v2->fetchSessions(missing.data(), missing.size());
+        for (size_t i = 0; i < missing.size() && i < found.size(); i++)
+            sessions[missing_index[i]] = found[i];
+    } else {
+        for (size_t i = 0; i < missing.size(); i++)
+            sessions[missing_index[i]].reset(m_storage->fetchSession(missing[i]));
+    }
+    return sessions;
+}
+
+void onyx::WriteBehindStorage::removeSession(const std::string & id) noexcept {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    enqueue(lock, id, {true, "", onyx::session::User()}, m_settings.durability != Durability::ASYNC);
+}
+
+void onyx::WriteBehindStorage::clearAllSession() noexcept {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // the batch being written would restore some sessions after the clear
+        m_written.wait(lock, [this]() {
+            return m_writing.empty();
+        });
+        m_pending.clear();
+        // writes waiting for a dropped batch are released
+        m_flushed = m_queued;
+        m_written.notify_all();
+    }
+    m_storage->clearAllSession();
+}
+
+bool onyx::WriteBehindStorage::enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept {
+    // the storage then has every session created so far
+    flush();
+    return m_storage->enumerateSessions(callback);
+}
+
+void onyx::WriteBehindStorage::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t queued = m_queued;
+    if (m_flushed >= queued)
+        return;
+    m_urgent = true;
+    m_wake.notify_one();
+    m_written.wait(lock, [this, queued]() {
+        return m_flushed >= queued;
+    });
+}
+
+size_t onyx::WriteBehindStorage::getPending() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.size() + m_writing.size();
+}
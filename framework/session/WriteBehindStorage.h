@@ -0,0 +1,149 @@
+#ifndef WRITEBEHINDSTORAGE_H
+#define WRITEBEHINDSTORAGE_H
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include "Session.h"
+
+namespace onyx {
+
+    /*
+     * Session storage writing to another storage from a background thread. Creations and removals are
+     * queued, only the last write of an id is kept, and the queue is written in one batch every flush_interval
+     * or as soon as batch_size writes are pending. Queued writes are visible to fetchSession at once.
+     * The durability decides which writes wait for their batch to be written.
+     * Lookups missing the queue go to the storage in batches when it is an ISessionStorageV2
+     */
+    class WriteBehindStorage : public ISessionStorageV2 {
+    public:
+
+        enum class Durability {
+            /*
+             * writes return once queued, the queue is lost if the process dies
+             */
+            ASYNC,
+            /*
+             * removals (logout) wait for their batch, a logout is never lost
+             */
+            SYNC_REMOVE,
+            /*
+             * every write waits for its batch, concurrent writes share one batch.
+             * Only then does createSession report a session the storage refused
+             */
+            SYNC
+        };
+
+        struct Settings {
+            size_t batch_size = 128;
+            std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100);
+            Durability durability = Durability::SYNC_REMOVE;
+            /*
+             * writers wait while the queue is this long
+             */
+            size_t max_pending = 65536;
+        };
+
+    private:
+
+        struct Write {
+            bool remove;
+            std::string token;
+            onyx::session::User user;
+        };
+
+        ISessionStorage * m_storage;
+        ISessionStorageV2 * m_storage_v2;
+        Settings m_settings;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_written;
+        /*
+         * last write of every id waiting for the next batch
+         */
+        std::unordered_map<std::string, Write> m_pending;
+        /*
+         * batch being written, still served by fetchSession
+         */
+        std::unordered_map<std::string, Write> m_writing;
+        /*
+         * creations the storage refused, kept until their SYNC writer reads them
+         */
+        std::unordered_set<std::string> m_failed;
+        uint64_t m_queued = 0;
+        uint64_t m_flushed = 0;
+        bool m_urgent = false;
+        bool m_stop = false;
+        std::thread m_thread;
+
+        void run();
+        /*
+         * queue the write and wait for its batch when durable, m_mutex must be locked
+         */
+        void enqueue(std::unique_lock<std::mutex> & lock, const std::string & id, Write && write, bool durable);
+        /*
+         * queued write of the id, m_mutex must be locked
+         */
+        const Write * findWrite(const std::string & id) const;
+
+    public:
+
+        using ISessionStorageV2::fetchSessionAsync;
+        using ISessionStorageV2::fetchSessions;
+
+        /*
+         * storage isn't owned, it must outlive this object
+         */
+        WriteBehindStorage(ISessionStorage * storage, const Settings & settings);
+
+        explicit WriteBehindStorage(ISessionStorage * storage) : WriteBehindStorage(storage, Settings()) {
+        }
+
+        /*
+         * writes the queue before returning
+         */
+        virtual ~WriteBehindStorage();
+
+        WriteBehindStorage(const WriteBehindStorage &) = delete;
+        WriteBehindStorage & operator=(const WriteBehindStorage &) = delete;
+
+        virtual void createSession(const std::string & id, const std::string & token, const std::string & user_id) noexcept override;
+
+        virtual bool createSession(const std::string & id, const std::string & token, const onyx::session::User & user) noexcept override;
+
+        virtual Session * fetchSession(const std::string & id) noexcept override;
+
+        virtual void removeSession(const std::string & id) noexcept override;
+
+        virtual void clearAllSession() noexcept override;
+
+        virtual bool enumerateSessions(const std::function<void(const std::string & id)> & callback) noexcept override;
+
+        virtual bool isShared() const noexcept override {
+            return m_storage->isShared();
+        }
+
+        virtual void fetchSessionAsync(const std::string & id, FetchCallback callback) noexcept override;
+
+        virtual std::vector<std::shared_ptr<const Session>> fetchSessions(const std::string * ids, size_t count) noexcept override;
+
+        /*
+         * wait until every write queued so far is written
+         */
+        void flush();
+
+        size_t getPending();
+
+        ISessionStorage * getStorage() const {
+            return m_storage;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,188 @@
+#include "CompiledTemplate.h"
+#include <cctype>
+
+namespace {
+
+    const size_t MAX_PARTIAL_DEPTH = 16;
+
+    std::string trim(const std::string & str) {
+        size_t begin = 0;
+        size_t end = str.size();
+        while (begin < end && isspace(static_cast<unsigned char> (str[begin])))
+            begin++;
+        while (end > begin && isspace(static_cast<unsigned char> (str[end - 1])))
+            end--;
+        return str.substr(begin, end - begin);
+    }
+
+    bool isDelimiterValid(const std::string & delimiter) {
+        for (char ch : delimiter) {
+            if (ch == '=' || isspace(static_cast<unsigned char> (ch)))
+                return false;
+        }
+        return true;
+    }
+
+    /*
+     * {{=<% %>=}}, same rules as kainjow::mustache
+     */
+    bool parseDelimiters(const std::string & tag, std::string & begin, std::string & end) {
+        if (tag.size() < 5 || tag.back() != '=')
+            return false;
+        std::string contents = trim(tag.substr(1, tag.size() - 2));
+        size_t space = contents.find(' ');
+        if (space == std::string::npos)
+            return false;
+        size_t next = contents.find_first_not_of(' ', space + 1);
+        std::string new_begin = contents.substr(0, space);
+        std::string new_end = contents.substr(next);
+        if (!isDelimiterValid(new_begin) || !isDelimiterValid(new_end))
+            return false;
+        begin = new_begin;
+        end = new_end;
+        return true;
+    }
+}
+
+constexpr const char * onyx::CompiledTemplate::CSRF_TOKEN_VARIABLE;
+
+onyx::CompiledTemplate::CompiledTemplate(const std::string & source, const PartialResolver & resolver) {
+    compile(source, resolver, 0, 0);
+    Instruction end = {Op::END, 0, 0, 0};
+    m_code.push_back(end);
+}
+
+void onyx::CompiledTemplate::addText(const std::string & source, size_t position, size_t size) {
+    if (size == 0)
+        return;
+    if (!m_code.empty() && m_code.back().op == Op::TEXT && m_code.back().offset + m_code.back().size == m_text.size()) {
+        // comments and delimiter changes leave adjacent literals, they are merged into one span
+        m_code.back().size += size;
+    } else {
+        Instruction instruction = {Op::TEXT, static_cast<uint32_t> (m_text.size()), static_cast<uint32_t> (size), 0};
+        m_code.push_back(instruction);
+    }
+    m_text.append(source, position, size);
+}
+
+void onyx::CompiledTemplate::addTag(Op op, const std::string & name) {
+    Name compiled;
+    compiled.implicit = name == ".";
+    if (!compiled.implicit) {
+        if (name.find('.') == std::string::npos) {
+            compiled.segments.push_back(name);
+        } else {
+            // "a.b" is looked up as b in a, a trailing dot doesn't add a segment
+            size_t begin = 0;
+            for (;;) {
+                size_t dot = name.find('.', begin);
+                if (dot == std::string::npos) {
+                    if (begin < name.size())
+                        compiled.segments.push_back(name.substr(begin));
+                    break;
+                }
+                compiled.segments.push_back(name.substr(begin, dot - begin));
+                begin = dot + 1;
+            }
+        }
+    }
+    Instruction instruction = {op, static_cast<uint32_t> (m_names.size()), 0, 0};
+    if ((op == Op::VARIABLE || op == Op::UNESCAPED_VARIABLE) && name == CSRF_TOKEN_VARIABLE) {
+        instruction.op = Op::CSRF_TOKEN;
+        m_csrf = true;
+        instruction.size = op == Op::VARIABLE ? 1 : 0;
+    }
+    m_names.push_back(compiled);
+    m_code.push_back(instruction);
+}
+
+void onyx::CompiledTemplate::compile(const std::string & source, const PartialResolver & resolver, size_t depth, size_t partial_depth) {
+    std::string begin = "{{";
+    std::string end = "}}";
+    const std::string unescaped_end = "}}}";
+    bool brace = true;
+    // open sections: index of the instruction, name and position in the source
+    struct Section {
+        size_t index;
+        std::string name;
+        size_t position;
+    };
+    std::vector<Section> sections;
+
+    const size_t size = source.size();
+    size_t position = 0;
+    while (position != size) {
+        size_t tag_start = source.find(begin, position);
+        if (tag_start == std::string::npos) {
+            addText(source, position, size - position);
+            break;
+        }
+        addText(source, position, tag_start - position);
+
+        size_t contents = tag_start + begin.size();
+        bool unescaped = brace && contents < size && source[contents] == begin[0];
+        if (unescaped)
+            contents++;
+        const std::string & tag_end = unescaped ? unescaped_end : end;
+        size_t tag_stop = source.find(tag_end, contents);
+        if (tag_stop == std::string::npos)
+            throw onyx::Exception("Unclosed tag at " + std::to_string(tag_start), 500);
+        std::string tag = trim(source.substr(contents, tag_stop - contents));
+        position = tag_stop + tag_end.size();
+
+        if (!tag.empty() && tag[0] == '=') {
+            if (!parseDelimiters(tag, begin, end))
+                throw onyx::Exception("Invalid set delimiter tag at " + std::to_string(tag_start), 500);
+            brace = begin == "{{" && end == "}}";
+            continue;
+        }
+        if (unescaped) {
+            addTag(Op::UNESCAPED_VARIABLE, tag);
+            continue;
+        }
+        if (tag.empty()) {
+            addTag(Op::VARIABLE, tag);
+            continue;
+        }
+
+        std::string name = trim(tag.substr(1));
+        switch (tag[0]) {
+            case '#':
+            case '^':
+                if (depth + sections.size() >= MAX_DEPTH)
+                    throw onyx::Exception("Sections nested deeper than " + std::to_string(MAX_DEPTH) + " at " + std::to_string(tag_start), 500);
+                sections.push_back({m_code.size(), name, tag_start});
+                addTag(tag[0] == '#' ? Op::SECTION : Op::INVERTED_SECTION, name);
+                break;
+            case '/':
+            {
+                if (sections.empty())
+                    throw onyx::Exception("Unopened section \"" + name + "\" at " + std::to_string(tag_start), 500);
+                Section & section = sections.back();
+                if (section.name != name)
+                    throw onyx::Exception("Unclosed section \"" + section.name + "\" at " + std::to_string(section.position), 500);
+                Instruction instruction = {Op::END_SECTION, 0, 0, static_cast<uint32_t> (section.index + 1)};
+                m_code.push_back(instruction);
+                m_code[section.index].jump = m_code.size();
+                sections.pop_back();
+                break;
+            }
+            case '>':
+                if (!resolver)
+                    break;
+                if (partial_depth >= MAX_PARTIAL_DEPTH)
+                    throw onyx::Exception("Partials nested deeper than " + std::to_string(MAX_PARTIAL_DEPTH) + ": " + name, 500);
+                compile(resolver(name), resolver, depth + sections.size(), partial_depth + 1);
+                break;
+            case '!':
+                break;
+            case '&':
+                addTag(Op::UNESCAPED_VARIABLE, name);
+                break;
+            default:
+                addTag(Op::VARIABLE, tag);
+        }
+    }
+    if (!sections.empty())
+        throw onyx::Exception("Unclosed section \"" + sections.back().name + "\" at " + std::to_string(sections.back().position), 500);
+}
@@ -0,0 +1,269 @@
+#ifndef COMPILEDTEMPLATE_H
+#define COMPILEDTEMPLATE_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <boost/utility/string_view.hpp>
+#include "ContextTraits.h"
+#include "../exception/Exception.h"
+
+namespace onyx {
+
+    /*
+     * Mustache template flattened to a linear instruction array: literal spans, variable loads with
+     * names split at compile time, and section jumps. Rendering is a loop over the instructions with
+     * a fixed-size context stack, without recursion or allocation, and is safe from several threads.
+     *
+     * Output matches kainjow::mustache for the same data, except that lambdas aren't supported (rendering
+     * throws) and partials are inlined at compile time from the resolver instead of being read from the data.
+     * Any data type with a onyx::ContextTraits specialization can be rendered.
+     * Throws onyx::Exception with code 500 for an invalid template
+     */
+    class CompiledTemplate {
+    public:
+
+        /*
+         * source of a partial by name, nullptr or a throwing resolver for templates without partials
+         */
+        typedef std::function<std::string(const std::string & name)> PartialResolver;
+
+        /*
+         * deepest nesting of sections, partials included
+         */
+        static const size_t MAX_DEPTH = 64;
+
+        /*
+         * reserved variable replaced with the csrf_token argument of render
+         */
+        static constexpr const char * CSRF_TOKEN_VARIABLE = "csrf_token_value";
+
+        explicit CompiledTemplate(const std::string & source, const PartialResolver & resolver = nullptr);
+
+        /*
+         * sink(const char * data, size_t size) gets the output chunk by chunk.
+         * {{csrf_token_value}} renders csrf_token, or the variable of the data when it is empty
+         */
+        template<typename Data, typename Sink>
+        void render(const Data & data, Sink && sink, boost::string_view csrf_token = boost::string_view()) const;
+
+        /*
+         * the template has {{csrf_token_value}}
+         */
+        bool usesCSRFToken() const {
+            return m_csrf;
+        }
+
+        std::string render(const kainjow::mustache::data & data) const {
+            std::string result;
+            render(data, [&result](const char * chunk, size_t size) {
+                result.append(chunk, size);
+            });
+            return result;
+        }
+
+    private:
+
+        enum class Op : uint8_t {
+            TEXT, VARIABLE, UNESCAPED_VARIABLE, CSRF_TOKEN, SECTION, INVERTED_SECTION, END_SECTION, END
+        };
+
+        struct Instruction {
+            Op op;
+            /*
+             * TEXT - span of m_text, variables and sections - index of m_names
+             */
+            uint32_t offset;
+            /*
+             * TEXT - size of the span, CSRF_TOKEN - 1 when escaped
+             */
+            uint32_t size;
+            /*
+             * SECTION, INVERTED_SECTION - past the END_SECTION, END_SECTION - first instruction of the body
+             */
+            uint32_t jump;
+        };
+
+        struct Name {
+            /*
+             * {{.}}
+             */
+            bool implicit;
+            std::vector<std::string> segments;
+        };
+
+        std::string m_text;
+        std::vector<Instruction> m_code;
+        std::vector<Name> m_names;
+        bool m_csrf = false;
+
+        void compile(const std::string & source, const PartialResolver & resolver, size_t depth, size_t partial_depth);
+        void addText(const std::string & source, size_t position, size_t size);
+        void addTag(Op op, const std::string & name);
+
+        template<typename Sink>
+        static void escape(boost::string_view text, Sink & sink);
+
+        template<typename Traits>
+        static typename Traits::pointer lookup(const Name & name, const typename Traits::pointer * stack, size_t depth);
+    };
+
+    template<typename Sink>
+    void CompiledTemplate::escape(boost::string_view text, Sink & sink) {
+        size_t begin = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            const char * entity;
+            size_t size;
+            switch (text[i]) {
+                case '&':
+                    entity = "&amp;";
+                    size = 5;
+                    break;
+                case '<':
+                    entity = "&lt;";
+                    size = 4;
+                    break;
+                case '>':
+                    entity = "&gt;";
+                    size = 4;
+                    break;
+                case '"':
+                    entity = "&quot;";
+                    size = 6;
+                    break;
+                case '\'':
+                    entity = "&apos;";
+                    size = 6;
+                    break;
+                default:
+                    continue;
+            }
+            if (i > begin)
+                sink(text.data() + begin, i - begin);
+            sink(entity, size);
+            begin = i + 1;
+        }
+        if (text.size() > begin)
+            sink(text.data() + begin, text.size() - begin);
+    }
+
+    template<typename Traits>
+    typename Traits::pointer CompiledTemplate::lookup(const Name & name, const typename Traits::pointer * stack, size_t depth) {
+        if (name.implicit)
+            return stack[depth - 1];
+        for (size_t i = depth; i-- > 0;) {
+            typename Traits::pointer value = stack[i];
+            for (const std::string & segment : name.segments) {
+                value = Traits::member(value, segment);
+                if (value == nullptr)
+                    break;
+            }
+            if (value != nullptr)
+                return value;
+        }
+        return nullptr;
+    }
+
+    template<typename Data, typename Sink>
+    void CompiledTemplate::render(const Data & data, Sink && sink, boost::string_view csrf_token) const {
+        typedef ContextTraits<Data> Traits;
+        typedef typename Traits::pointer pointer;
+
+        struct Frame {
+            pointer list;
+            size_t index;
+            size_t size;
+            bool pushed;
+        };
+
+        pointer stack[MAX_DEPTH + 1];
+        Frame frames[MAX_DEPTH];
+        size_t depth = 1;
+        size_t frame_count = 0;
+        char buffer[32];
+        stack[0] = &data;
+
+        const Instruction * code = m_code.data();
+        uint32_t pc = 0;
+        for (;;) {
+            const Instruction & instruction = code[pc];
+            switch (instruction.op) {
+                case Op::TEXT:
+                    sink(m_text.data() + instruction.offset, instruction.size);
+                    pc++;
+                    break;
+                case Op::CSRF_TOKEN:
+                    if (!csrf_token.empty()) {
+                        escape(csrf_token, sink);
+                        pc++;
+                        break;
+                    }
+                    // no token, a variable of the data
+                case Op::VARIABLE:
+                case Op::UNESCAPED_VARIABLE:
+                {
+                    pointer value = lookup<Traits>(m_names[instruction.offset], stack, depth);
+                    boost::string_view text;
+                    if (value != nullptr && Traits::text(value, buffer, text)) {
+                        if (instruction.op == Op::VARIABLE || (instruction.op == Op::CSRF_TOKEN && instruction.size == 1))
+                            escape(text, sink);
+                        else if (!text.empty())
+                            sink(text.data(), text.size());
+                    }
+                    pc++;
+                    break;
+                }
+                case Op::SECTION:
+                {
+                    pointer value = lookup<Traits>(m_names[instruction.offset], stack, depth);
+                    if (value == nullptr || Traits::isFalsy(value)) {
+                        pc = instruction.jump;
+                        break;
+                    }
+                    Frame & frame = frames[frame_count++];
+                    frame.size = Traits::listSize(value);
+                    frame.index = 0;
+                    frame.pushed = true;
+                    frame.list = frame.size > 0 ? value : nullptr;
+                    stack[depth++] = frame.list != nullptr ? Traits::listAt(value, 0) : value;
+                    pc++;
+                    break;
+                }
+                case Op::INVERTED_SECTION:
+                {
+                    pointer value = lookup<Traits>(m_names[instruction.offset], stack, depth);
+                    if (value != nullptr && !Traits::isFalsy(value)) {
+                        pc = instruction.jump;
+                        break;
+                    }
+                    Frame & frame = frames[frame_count++];
+                    frame.list = nullptr;
+                    frame.pushed = value != nullptr;
+                    if (frame.pushed)
+                        stack[depth++] = value;
+                    pc++;
+                    break;
+                }
+                case Op::END_SECTION:
+                {
+                    Frame & frame = frames[frame_count - 1];
+                    if (frame.list != nullptr && ++frame.index < frame.size) {
+                        stack[depth - 1] = Traits::listAt(frame.list, frame.index);
+                        pc = instruction.jump;
+                        break;
+                    }
+                    if (frame.pushed)
+                        depth--;
+                    frame_count--;
+                    pc++;
+                    break;
+                }
+                case Op::END:
+                    return;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef CONTEXTTRAITS_H
+#define CONTEXTTRAITS_H
+
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include <boost/utility/string_view.hpp>
+#include "../common/mustache/mustache.h"
+#include "../common/json/json.hpp"
+#include "../exception/Exception.h"
+
+namespace onyx {
+
+    /*
+     * How onyx::CompiledTemplate reads the data it renders. A specialization provides:
+     *   pointer - handle of a value, nullptr when missing
+     *   member(object, key) - member of an object, nullptr for a missing key or a non-object
+     *   isFalsy(value) - a section over the value isn't rendered
+     *   listSize(value) - number of elements of a list, 0 for other values
+     *   listAt(list, index) - element of a list
+     *   text(value, buffer, text) - text of a variable (buffer may hold formatted numbers), false if it renders nothing
+     */
+    template<typename Data, typename Enable = void>
+    struct ContextTraits;
+
+    template<>
+    struct ContextTraits<kainjow::mustache::data> {
+        typedef const kainjow::mustache::data * pointer;
+
+        static pointer member(pointer object, const std::string & key) {
+            return object->get(key);
+        }
+
+        static bool isFalsy(pointer value) {
+            check(value);
+            return value->is_false() || value->is_empty_list();
+        }
+
+        static size_t listSize(pointer value) {
+            return value->is_list() ? value->list_value().size() : 0;
+        }
+
+        static pointer listAt(pointer list, size_t index) {
+            return &list->list_value()[index];
+        }
+
+        static bool text(pointer value, char (&)[32], boost::string_view & text) {
+            check(value);
+            if (!value->is_string())
+                return false;
+            text = value->string_value();
+            return true;
+        }
+
+    private:
+
+        static void check(pointer value) {
+            if (value->is_lambda() || value->is_lambda2())
+                throw onyx::Exception("Lambdas aren't supported by compiled templates", 500);
+        }
+    };
+
+    /*
+     * Renders straight from nlohmann::json (or another basic_json specialization) without building
+     * kainjow data. null, false and empty arrays are falsy, numbers and booleans are rendered as by dump()
+     */
+    template<typename BasicJsonType>
+    struct ContextTraits<BasicJsonType, typename std::enable_if<nlohmann::detail::is_basic_json<BasicJsonType>::value>::type> {
+        typedef const BasicJsonType * pointer;
+
+        static pointer member(pointer object, const std::string & key) {
+            if (!object->is_object())
+                return nullptr;
+            auto it = object->find(key);
+            return it == object->end() ? nullptr : &*it;
+        }
+
+        static bool isFalsy(pointer value) {
+            return value->is_null() || (value->is_boolean() && !value->template get<bool>()) || (value->is_array() && value->empty());
+        }
+
+        static size_t listSize(pointer value) {
+            return value->is_array() ? value->size() : 0;
+        }
+
+        static pointer listAt(pointer list, size_t index) {
+            return &(*list)[index];
+        }
+
+        static bool text(pointer value, char (&buffer)[32], boost::string_view & text) {
+            switch (value->type()) {
+                case nlohmann::detail::value_t::string:
+                {
+                    const auto & str = value->template get_ref<const typename BasicJsonType::string_t &>();
+                    text = boost::string_view(str.data(), str.size());
+                    return true;
+                }
+                case nlohmann::detail::value_t::boolean:
+                    text = value->template get<bool>() ? "true" : "false";
+                    return true;
+                case nlohmann::detail::value_t::number_integer:
+                    text = boost::string_view(buffer, snprintf(buffer, sizeof (buffer), "%lld", static_cast<long long> (value->template get<typename BasicJsonType::number_integer_t>())));
+                    return true;
+                case nlohmann::detail::value_t::number_unsigned:
+                    text = boost::string_view(buffer, snprintf(buffer, sizeof (buffer), "%llu", static_cast<unsigned long long> (value->template get<typename BasicJsonType::number_unsigned_t>())));
+                    return true;
+                case nlohmann::detail::value_t::number_float:
+                {
+                    double number = value->template get<double>();
+                    if (!std::isfinite(number))
+                        return false;
+                    text = boost::string_view(buffer, nlohmann::detail::to_chars(buffer, buffer + sizeof (buffer), number) - buffer);
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+    };
+}
+
+#endif
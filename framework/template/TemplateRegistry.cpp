@@ -0,0 +1,324 @@
+#include "TemplateRegistry.h"
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+onyx::TemplateRegistry * onyx::TemplateRegistry::m_instance = nullptr;
+
+thread_local std::unordered_map<std::string, onyx::TemplateRegistry::ThreadTemplate> onyx::TemplateRegistry::m_thread_templates;
+
+namespace {
+
+    /*
+     * context of a parsed template resolving the reserved {{csrf_token_value}}
+     */
+    class CSRFContext : public kainjow::mustache::context<std::string> {
+    private:
+        kainjow::mustache::data m_token;
+    public:
+
+        CSRFContext(const kainjow::mustache::data * data, boost::string_view token) : kainjow::mustache::context<std::string>(data), m_token(token.to_string()) {
+        }
+
+        virtual const kainjow::mustache::data * get(const std::string & name) const override {
+            if (name == onyx::CompiledTemplate::CSRF_TOKEN_VARIABLE)
+                return &m_token;
+            return kainjow::mustache::context<std::string>::get(name);
+        }
+    };
+}
+
+onyx::TemplateRegistry::TemplateRegistry() : m_directory("templates"), m_invalidations(0), m_inotify_fd(-1) {
+}
+
+void onyx::TemplateRegistry::setDirectory(const std::string & directory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory = directory;
+    while (!m_directory.empty() && m_directory.back() == '/')
+        m_directory.pop_back();
+    for (auto & watch : m_watches)
+        inotify_rm_watch(m_inotify_fd, watch.first);
+    m_watches.clear();
+    dropAll();
+}
+
+std::string onyx::TemplateRegistry::getDirectory() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_directory;
+}
+
+void onyx::TemplateRegistry::invalidate(const std::string & name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (name.empty()) {
+        dropAll();
+        return;
+    }
+    auto it = m_templates.find(name);
+    if (it != m_templates.end())
+        drop(it);
+    m_invalidations++;
+}
+
+void onyx::TemplateRegistry::setCompiled(const std::string & name, bool compiled) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (compiled)
+        m_compiled_names.insert(name);
+    else
+        m_compiled_names.erase(name);
+    // the threads make new copies, the parsed template is kept
+    auto it = m_templates.find(name);
+    if (it != m_templates.end()) {
+        it->second.valid->store(false, std::memory_order_release);
+        it->second.valid = std::make_shared<std::atomic<bool>>(true);
+    }
+}
+
+std::string onyx::TemplateRegistry::readFile(const std::string & name) {
+    if (name.empty() || name[0] == '/' || name.find("..") != std::string::npos)
+        throw onyx::Exception("Invalid template name: " + name, 500);
+    std::string path;
+    {
+        // a change after the watch is added bumps m_invalidations, the template read isn't cached then
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t slash = name.rfind('/');
+        watch(slash == std::string::npos ? "" : name.substr(0, slash + 1));
+        path = m_directory + "/" + name;
+    }
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        throw onyx::Exception("Template not found: " + name, 500);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+void onyx::TemplateRegistry::watch(const std::string & directory) {
+    for (auto & watch : m_watches) {
+        if (watch.second == directory)
+            return;
+    }
+    if (m_inotify_fd < 0) {
+        m_inotify_fd = inotify_init1(IN_CLOEXEC);
+        if (m_inotify_fd < 0) {
+            LOGE << "inotify_init1 failed, templates are not reloaded when changed";
+            return;
+        }
+        std::thread(&TemplateRegistry::listen, this).detach();
+    }
+    int wd = inotify_add_watch(m_inotify_fd, (m_directory + "/" + directory).c_str(),
+            IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF);
+    if (wd < 0) {
+        LOGE << "Can't watch template directory " << m_directory << "/" << directory;
+        return;
+    }
+    m_watches[wd] = directory;
+}
+
+std::unordered_map<std::string, onyx::TemplateRegistry::Template>::iterator onyx::TemplateRegistry::drop(std::unordered_map<std::string, Template>::iterator it) {
+    it->second.valid->store(false, std::memory_order_release);
+    return m_templates.erase(it);
+}
+
+void onyx::TemplateRegistry::dropAll() {
+    for (auto it = m_templates.begin(); it != m_templates.end();)
+        it = drop(it);
+    m_invalidations++;
+}
+
+void onyx::TemplateRegistry::erase(const std::string & file) {
+    // a file name, or a directory when it ends with a slash
+    for (auto it = m_templates.begin(); it != m_templates.end();) {
+        const std::vector<std::string> & files = it->second.files;
+        bool found = std::any_of(files.begin(), files.end(), [&file](const std::string & name) {
+            return file.back() == '/' ? name.compare(0, file.size(), file) == 0 : name == file;
+        });
+        if (found)
+            it = drop(it);
+        else
+            ++it;
+    }
+    m_invalidations++;
+}
+
+void onyx::TemplateRegistry::listen() {
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        ssize_t size = read(m_inotify_fd, buffer, sizeof (buffer));
+        if (size < 0 && errno == EINTR)
+            continue;
+        if (size <= 0) {
+            LOGE << "Reading inotify events failed (" << strerror(errno) << "), templates are not reloaded when changed anymore";
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (char * ptr = buffer; ptr < buffer + size;) {
+            const inotify_event * event = reinterpret_cast<const inotify_event *> (ptr);
+            ptr += sizeof (inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) {
+                dropAll();
+                continue;
+            }
+            auto watch = m_watches.find(event->wd);
+            if (watch == m_watches.end())
+                continue;
+            if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                // the directory is gone, it is watched again when one of its templates is loaded
+                if (watch->second.empty())
+                    dropAll();
+                else
+                    erase(watch->second);
+                if (!(event->mask & IN_IGNORED))
+                    inotify_rm_watch(m_inotify_fd, event->wd);
+                m_watches.erase(watch);
+                continue;
+            }
+            if (event->len > 0)
+                erase(watch->second + event->name);
+        }
+    }
+}
+
+onyx::TemplateRegistry::Template onyx::TemplateRegistry::load(const std::string & name, bool compiled) {
+    Template tmpl;
+    tmpl.files.push_back(name);
+    if (compiled) {
+        tmpl.compiled = std::make_shared<CompiledTemplate>(readFile(name), [this, &tmpl](const std::string & partial) {
+            tmpl.files.push_back(partial);
+            return readFile(partial);
+        });
+        return tmpl;
+    }
+    std::string source = readFile(name);
+    std::shared_ptr<kainjow::mustache::mustache> tree = std::make_shared<kainjow::mustache::mustache>(source);
+    if (!tree->is_valid())
+        throw onyx::Exception("Template " + name + ": " + tree->error_message(), 500);
+    tmpl.parsed = tree;
+    tmpl.csrf = source.find(CompiledTemplate::CSRF_TOKEN_VARIABLE) != std::string::npos;
+    return tmpl;
+}
+
+const onyx::TemplateRegistry::ThreadTemplate & onyx::TemplateRegistry::fetch(const std::string & name, bool compiled_only) {
+    ThreadTemplate & cached = m_thread_templates[name];
+    if (cached.valid && cached.valid->load(std::memory_order_acquire)) {
+        bool use_compiled = compiled_only || cached.compiled_name;
+        if ((use_compiled && cached.compiled) || (!use_compiled && cached.parsed))
+            return cached;
+    }
+
+    ThreadTemplate copy;
+    Template tmpl;
+    bool use_compiled;
+    uint64_t invalidations;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        copy.compiled_name = m_compiled_names.count(name) > 0;
+        use_compiled = compiled_only || copy.compiled_name;
+        auto it = m_templates.find(name);
+        if (it != m_templates.end() && (use_compiled ? it->second.compiled != nullptr : it->second.parsed != nullptr))
+            tmpl = it->second;
+        invalidations = m_invalidations;
+    }
+    if (!tmpl.valid) {
+        // other requests keep rendering while the file is read and parsed
+        Template loaded = load(name, use_compiled);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_invalidations != invalidations) {
+            // changed meanwhile, used for this render only
+            tmpl = loaded;
+        } else {
+            Template & stored = m_templates[name];
+            if (!stored.valid)
+                stored.valid = std::make_shared<std::atomic<bool>>(true);
+            if (use_compiled && !stored.compiled) {
+                stored.compiled = loaded.compiled;
+                stored.files.insert(stored.files.end(), loaded.files.begin(), loaded.files.end());
+            } else if (!use_compiled && !stored.parsed) {
+                stored.parsed = loaded.parsed;
+                stored.csrf = loaded.csrf;
+                if (stored.files.empty())
+                    stored.files = loaded.files;
+            }
+            tmpl = stored;
+        }
+    }
+
+    copy.valid = tmpl.valid;
+    copy.csrf = tmpl.csrf;
+    // the thread keeps the other form of the same template, render picks one by compiled_name
+    bool same = copy.valid && copy.valid == cached.valid;
+    if (use_compiled) {
+        copy.compiled = tmpl.compiled;
+        if (same)
+            copy.parsed = cached.parsed;
+    } else {
+        copy.parsed = std::make_shared<kainjow::mustache::mustache>(*tmpl.parsed);
+        if (same)
+            copy.compiled = cached.compiled;
+    }
+    cached = copy;
+    return cached;
+}
+
+void onyx::TemplateRegistry::discard(const std::string & name) {
+    m_thread_templates.erase(name);
+}
+
+void onyx::TemplateRegistry::render(const std::string & name, const kainjow::mustache::data & data, const RenderHandler & handler, const CSRFTokenProvider & csrf_token) {
+    const ThreadTemplate & cached = fetch(name, false);
+    if (cached.compiled_name) {
+        std::string token = cached.compiled->usesCSRFToken() && csrf_token ? csrf_token() : "";
+        cached.compiled->render(data, [&handler](const char * chunk, size_t size) {
+            handler(boost::string_view(chunk, size));
+        }, token);
+        return;
+    }
+
+    std::shared_ptr<kainjow::mustache::mustache> tmpl = cached.parsed;
+    std::string token = cached.csrf && csrf_token ? csrf_token() : "";
+    if (!token.empty()) {
+        // kainjow renders a custom context into a string only
+        CSRFContext context(&data, token);
+        std::string result = tmpl->render(context);
+        if (tmpl->is_valid())
+            handler(result);
+    } else {
+        tmpl->render(data, [&handler](const std::string & chunk) {
+            handler(chunk);
+        });
+    }
+    if (!tmpl->is_valid()) {
+        // the copy keeps the error of a failed render (lambda, partial), a fresh one is made next time
+        std::string error = tmpl->error_message();
+        discard(name);
+        throw onyx::Exception("Template " + name + ": " + error, 500);
+    }
+}
+
+std::string onyx::TemplateRegistry::render(const std::string & name, const kainjow::mustache::data & data) {
+    std::string result;
+    render(name, data, [&result](boost::string_view chunk) {
+        result.append(chunk.data(), chunk.size());
+    });
+    return result;
+}
+
+void onyx::TemplateRegistry::render(const std::string & name, const nlohmann::json & data, const RenderHandler & handler, const CSRFTokenProvider & csrf_token) {
+    std::shared_ptr<const CompiledTemplate> compiled = fetch(name, true).compiled;
+    std::string token = compiled->usesCSRFToken() && csrf_token ? csrf_token() : "";
+    compiled->render(data, [&handler](const char * chunk, size_t size) {
+        handler(boost::string_view(chunk, size));
+    }, token);
+}
+
+std::string onyx::TemplateRegistry::render(const std::string & name, const nlohmann::json & data) {
+    std::string result;
+    render(name, data, [&result](boost::string_view chunk) {
+        result.append(chunk.data(), chunk.size());
+    });
+    return result;
+}
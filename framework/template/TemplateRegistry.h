@@ -0,0 +1,166 @@
+#ifndef TEMPLATEREGISTRY_H
+#define TEMPLATEREGISTRY_H
+
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <set>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <boost/utility/string_view.hpp>
+#include "../common/mustache/mustache.h"
+#include "CompiledTemplate.h"
+#include "../common/json/json.hpp"
+#include "../exception/Exception.h"
+#include "../common/plog/Log.h"
+
+namespace onyx {
+
+    /*
+     * Process-wide cache of parsed Mustache templates. A file is read and parsed once, each thread renders
+     * its own copy of the parsed template (kainjow::mustache isn't safe to render concurrently).
+     * Templates marked with setCompiled are compiled to onyx::CompiledTemplate instead, shared by all threads.
+     * Files are watched with inotify: a modified, moved or deleted template is parsed again on the next render,
+     * the other templates stay cached. Files are read and parsed outside the lock of the registry.
+     * Names are paths relative to the templates directory, e.g. "users/list.html"
+     */
+    class TemplateRegistry {
+    public:
+
+        /*
+         * gets the output chunk by chunk
+         */
+        typedef std::function<void(boost::string_view chunk)> RenderHandler;
+
+        /*
+         * CSRF token for {{csrf_token_value}}, called only by templates using it
+         */
+        typedef std::function<std::string()> CSRFTokenProvider;
+
+    private:
+
+        struct Template {
+            std::shared_ptr<const kainjow::mustache::mustache> parsed;
+            std::shared_ptr<const CompiledTemplate> compiled;
+            /*
+             * the template and the partials inlined into the compiled one
+             */
+            std::vector<std::string> files;
+            /*
+             * the parsed template uses {{csrf_token_value}}
+             */
+            bool csrf = false;
+            /*
+             * cleared when the template is dropped or marked with setCompiled, the copies of the threads check it
+             */
+            std::shared_ptr<std::atomic<bool>> valid;
+        };
+
+        /*
+         * template used by a thread, parsed is a copy owned by the thread
+         */
+        struct ThreadTemplate {
+            /*
+             * of the template it was copied from, nullptr when the copy wasn't cached
+             */
+            std::shared_ptr<const std::atomic<bool>> valid;
+            /*
+             * marked with setCompiled
+             */
+            bool compiled_name = false;
+            bool csrf = false;
+            std::shared_ptr<kainjow::mustache::mustache> parsed;
+            std::shared_ptr<const CompiledTemplate> compiled;
+        };
+
+        static TemplateRegistry * m_instance;
+        static thread_local std::unordered_map<std::string, ThreadTemplate> m_thread_templates;
+
+        std::string m_directory;
+        std::mutex m_mutex;
+        std::unordered_map<std::string, Template> m_templates;
+        std::set<std::string> m_compiled_names;
+        /*
+         * bumped on every invalidation, a template read meanwhile isn't cached
+         */
+        uint64_t m_invalidations;
+        int m_inotify_fd;
+        /*
+         * inotify watch descriptor -> directory relative to m_directory ("" or "users/")
+         */
+        std::map<int, std::string> m_watches;
+
+        TemplateRegistry();
+
+        /*
+         * the directory of the file is watched before it is read
+         */
+        std::string readFile(const std::string & name);
+        /*
+         * the mutex must be locked for watch, drop, dropAll and erase
+         */
+        void watch(const std::string & directory);
+        std::unordered_map<std::string, Template>::iterator drop(std::unordered_map<std::string, Template>::iterator it);
+        void dropAll();
+        void erase(const std::string & file);
+        void listen();
+        /*
+         * read and parse (compile when compiled) the template, without the mutex
+         */
+        Template load(const std::string & name, bool compiled);
+        /*
+         * template to render with: compiled is set for templates marked with setCompiled
+         * or when compiled_only, parsed otherwise
+         */
+        const ThreadTemplate & fetch(const std::string & name, bool compiled_only);
+        void discard(const std::string & name);
+
+    public:
+
+        static TemplateRegistry * getInstance() noexcept {
+            if (m_instance == nullptr)
+                m_instance = new TemplateRegistry;
+            return m_instance;
+        }
+
+        /*
+         * directory of the templates ("templates" by default), the cache is cleared
+         */
+        void setDirectory(const std::string & directory);
+
+        std::string getDirectory();
+
+        /*
+         * drop a template (every template for an empty name) from the cache
+         */
+        void invalidate(const std::string & name = "");
+
+        /*
+         * render the template with onyx::CompiledTemplate, for the hottest pages.
+         * Its partials ({{>name}}) are templates of the registry, lambdas aren't supported
+         */
+        void setCompiled(const std::string & name, bool compiled = true);
+
+        /*
+         * render a template from the cache, handler gets the output chunk by chunk (literal text
+         * is passed without a copy). {{csrf_token_value}} renders the token of csrf_token when it isn't empty.
+         * Throws onyx::Exception when the file is missing or the template is invalid
+         */
+        void render(const std::string & name, const kainjow::mustache::data & data, const RenderHandler & handler, const CSRFTokenProvider & csrf_token = nullptr);
+
+        std::string render(const std::string & name, const kainjow::mustache::data & data);
+
+        /*
+         * render a template with onyx::CompiledTemplate straight from JSON, no kainjow data is built
+         */
+        void render(const std::string & name, const nlohmann::json & data, const RenderHandler & handler, const CSRFTokenProvider & csrf_token = nullptr);
+
+        std::string render(const std::string & name, const nlohmann::json & data);
+    };
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Test of the form fields of a streamed multipart/form-data POST: the CSRF filter reads csrf_token with
+ * ONObject::getFormField before the handler, the handler must still get every part. Run with make test
+ */
+
+#include "../framework/object/ONObject.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+    size_t failures = 0;
+
+    const char * CONTENT_TYPE = "multipart/form-data; boundary=XyZ";
+
+    void expect(const std::string & what, bool result) {
+        if (!result) {
+            std::cerr << what << " failed" << std::endl;
+            failures++;
+        }
+    }
+
+    std::string field(const std::string & name, const std::string & value) {
+        return "--XyZ\r\nContent-Disposition: form-data; name=\"" + name + "\"\r\n\r\n" + value + "\r\n";
+    }
+
+    std::string file(const std::string & name, const std::string & content) {
+        return "--XyZ\r\nContent-Disposition: form-data; name=\"" + name + "\"; filename=\"a.txt\"\r\n"
+                "Content-Type: text/plain\r\n\r\n" + content + "\r\n";
+    }
+
+    /*
+     * POST whose body is read 7 bytes at a time, as it is from the web server
+     */
+    onyx::ONObject streamed(const std::string & body) {
+        onyx::ONObject obj(onyx::TokenCollection(""), onyx::ParamCollection(""), onyx::CookieCollection(""), "", CONTENT_TYPE);
+        std::shared_ptr<size_t> offset = std::make_shared<size_t>(0);
+        obj.setBodyReader([body, offset](char * buffer, size_t size) -> size_t {
+            size_t read = std::min(std::min(size, static_cast<size_t> (7)), body.size() - *offset);
+            memcpy(buffer, body.data() + *offset, read);
+            *offset += read;
+            return read;
+        }, onyx::multipart::Settings());
+        return obj;
+    }
+
+    std::string names(onyx::ONObject & obj) {
+        std::string result;
+        for (auto & part : obj.getMultipart())
+            result += part.getName() + "=" + (part.getFilename().empty() ? part.getData().to_string() : "<file>") + ";";
+        return result;
+    }
+}
+
+int main() {
+    std::string content(300 * 1024, 'x');
+    std::string value;
+
+    onyx::ONObject upload = streamed(field("title", "report") + field("csrf_token", "secret") + file("upload", content) + "--XyZ--\r\n");
+    expect("csrf_token of a multipart form", upload.getFormField("csrf_token", value) && value == "secret");
+    expect("second lookup", upload.getFormField("title", value) && value == "report");
+    expect("parts after the lookup", names(upload) == "title=report;csrf_token=secret;upload=<file>;");
+
+    onyx::ONObject late = streamed(file("upload", content) + field("csrf_token", "secret") + "--XyZ--\r\n");
+    expect("csrf_token after a file upload", !late.getFormField("csrf_token", value));
+    expect("parts after a failed lookup", names(late) == "upload=<file>;csrf_token=secret;");
+
+    onyx::ONObject missing = streamed(field("title", "report") + "--XyZ--\r\n");
+    expect("missing csrf_token", !missing.getFormField("csrf_token", value));
+    expect("parts after a missing field", names(missing) == "title=report;");
+
+    std::string body = "title=report&csrf_token=s%20t";
+    onyx::ONObject form(onyx::TokenCollection(""), onyx::ParamCollection(""), onyx::CookieCollection(""), body, "application/x-www-form-urlencoded");
+    expect("csrf_token of an urlencoded form", form.getFormField("csrf_token", value) && value == "s t");
+
+    if (failures != 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "MultipartFormTest: form fields are read ahead of the handler" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,190 @@
+/*
+ * Differential test of onyx::CompiledTemplate against the kainjow::mustache renderer: fixed cases, then
+ * random templates over random data. Both renderers must produce the same output, or both reject the
+ * template. Run with make test, the optional argument is the number of random templates
+ */
+
+#include "../framework/template/CompiledTemplate.h"
+#include <random>
+#include <iostream>
+#include <cstdlib>
+
+using kainjow::mustache::data;
+using kainjow::mustache::mustache;
+using kainjow::mustache::partial;
+
+namespace {
+
+    const char * PARTIAL = "[{{a}}{{#b}}<{{.}}>{{/b}}]";
+
+    std::mt19937 rng(42);
+
+    data randomData(int depth) {
+        int type = rng() % 6;
+        if (depth > 3)
+            type = rng() % 3;
+        switch (type) {
+            case 0:
+            {
+                const char * strings[] = {"", "<&>\"'", "hi", "x y"};
+                return data(std::string(strings[rng() % 4]));
+            }
+            case 1:
+                return data(data::type::bool_true);
+            case 2:
+                return data(data::type::bool_false);
+            case 3:
+            case 4:
+            {
+                data object;
+                int size = rng() % 4;
+                for (int i = 0; i < size; i++)
+                    object.set(std::string(1, "abcx"[rng() % 4]), randomData(depth + 1));
+                if (rng() % 3 == 0)
+                    object.set("items", randomData(depth + 1));
+                return object;
+            }
+            default:
+            {
+                data list(data::type::list);
+                int size = rng() % 3;
+                for (int i = 0; i < size; i++)
+                    list.push_back(randomData(depth + 1));
+                return list;
+            }
+        }
+    }
+
+    std::string randomTemplate(int depth) {
+        const char * names[] = {"a", "b", "c", "a.b", "b.c", ".", "x", "a.x", "items"};
+        std::string source;
+        int size = rng() % 6;
+        for (int i = 0; i < size; i++) {
+            std::string name = names[rng() % 9];
+            switch (rng() % 10) {
+                case 0: source += "txt";
+                    break;
+                case 1: source += "{{" + name + "}}";
+                    break;
+                case 2: source += "{{{" + name + "}}}";
+                    break;
+                case 3: source += "{{& " + name + " }}";
+                    break;
+                case 4:
+                    if (depth < 4)
+                        source += "{{#" + name + "}}" + randomTemplate(depth + 1) + "{{/" + name + "}}";
+                    break;
+                case 5:
+                    if (depth < 4)
+                        source += "{{^" + name + "}}" + randomTemplate(depth + 1) + "{{/" + name + "}}";
+                    break;
+                case 6: source += "{{! comment }}";
+                    break;
+                case 7: source += "{{=<% %>=}}<%" + name + "%><%={{ }}=%>";
+                    break;
+                case 8: source += (rng() % 5 == 0) ? "{{#a}}" : "\n";
+                    break;
+                case 9: source += "{{>p}}";
+                    break;
+            }
+        }
+        return source;
+    }
+
+    /*
+     * root object of the random data, with the partial kainjow looks up in the data
+     */
+    data randomRoot() {
+        data root = randomData(0);
+        while (!root.is_object())
+            root = randomData(0);
+        root.set("p", partial([]() {
+            return std::string(PARTIAL);
+        }));
+        return root;
+    }
+
+    /*
+     * false and a report on stderr when the renderers disagree
+     */
+    bool check(const std::string & source, const data & root) {
+        mustache reference(source);
+        bool reference_valid = reference.is_valid();
+        std::string expected;
+        if (reference_valid)
+            expected = reference.render(root);
+        try {
+            onyx::CompiledTemplate compiled(source, [](const std::string &) {
+                return std::string(PARTIAL);
+            });
+            std::string result = compiled.render(root);
+            if (!reference_valid) {
+                std::cerr << "accepted, kainjow rejects it: " << source << std::endl;
+                return false;
+            }
+            if (result != expected) {
+                std::cerr << "different output for " << source << std::endl << "expected: " << expected << std::endl << "got:      " << result << std::endl;
+                return false;
+            }
+        } catch (const onyx::Exception & ex) {
+            if (reference_valid) {
+                std::cerr << "rejected (" << ex.what() << "), kainjow accepts it: " << source << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char ** argv) {
+    size_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+    size_t failures = 0;
+
+    data user;
+    user.set("name", "Ann <admin>");
+    user.set("admin", data::type::bool_true);
+    data items(data::type::list);
+    for (int i = 0; i < 3; i++) {
+        data item;
+        item.set("id", std::to_string(i));
+        items.push_back(item);
+    }
+    data root;
+    root.set("user", user);
+    root.set("items", items);
+    root.set("empty", data::type::list);
+    root.set("p", partial([]() {
+        return std::string(PARTIAL);
+    }));
+    const char * cases[] = {
+        "Hello {{user.name}}",
+        "Hello {{{user.name}}} {{&user.name}}",
+        "{{#user.admin}}admin{{/user.admin}}{{^user.admin}}user{{/user.admin}}",
+        "<ul>{{#items}}<li>{{id}}</li>{{/items}}</ul>",
+        "{{#empty}}never{{/empty}}{{^empty}}none{{/empty}}",
+        "{{#user}}{{name}} {{#items}}{{id}}{{/items}}{{/user}}",
+        "{{=<% %>=}}<% user.name %>",
+        "{{! comment }}\n  {{#items}}\n{{id}}\n  {{/items}}\n",
+        "{{>p}}",
+        "{{#items}}",
+        "{{/items}}",
+        "{{missing}}{{missing.deep}}",
+    };
+    for (const char * source : cases) {
+        if (!check(source, root))
+            failures++;
+    }
+
+    for (size_t i = 0; i < iterations; i++) {
+        std::string source = randomTemplate(0);
+        if (!check(source, randomRoot()) && ++failures >= 10)
+            break;
+    }
+
+    if (failures != 0) {
+        std::cerr << failures << " templates render differently" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "TemplateEquivalenceTest: " << sizeof (cases) / sizeof (cases[0]) + iterations << " templates render the same" << std::endl;
+    return EXIT_SUCCESS;
+}
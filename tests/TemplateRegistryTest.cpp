@@ -0,0 +1,96 @@
+/*
+ * Test of onyx::TemplateRegistry switching one template between the parsed and the compiled renderer:
+ * a JSON render or setCompiled must not make the kainjow renders compiled, setCompiled(name, false) must
+ * make them parsed again. Run with make test
+ */
+
+#include "../framework/template/TemplateRegistry.h"
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+
+using kainjow::mustache::data;
+using kainjow::mustache::lambda;
+using kainjow::mustache::partial;
+
+namespace {
+
+    size_t failures = 0;
+
+    void expect(const std::string & what, const std::string & result, const std::string & expected) {
+        if (result != expected) {
+            std::cerr << what << ": expected \"" << expected << "\", got \"" << result << "\"" << std::endl;
+            failures++;
+        }
+    }
+
+    /*
+     * output of a kainjow render, or the message of the exception
+     */
+    std::string renderData(const std::string & name, const data & root) {
+        try {
+            return onyx::TemplateRegistry::getInstance()->render(name, root);
+        } catch (const onyx::Exception & ex) {
+            return std::string("exception: ") + ex.what();
+        }
+    }
+}
+
+int main() {
+    char directory[] = "/tmp/onyx-templates-XXXXXX";
+    if (mkdtemp(directory) == nullptr) {
+        std::cerr << "mkdtemp failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string page = std::string(directory) + "/page.html";
+    std::string part = std::string(directory) + "/part";
+    std::ofstream(page) << "{{name}}:{{#upper}}x{{/upper}}";
+    std::ofstream(part) << "file";
+
+    onyx::TemplateRegistry * registry = onyx::TemplateRegistry::getInstance();
+    registry->setDirectory(directory);
+
+    data root;
+    root.set("name", "ann");
+    root.set("upper", lambda([](const std::string & text) {
+        return text == "x" ? std::string("X") : text;
+    }));
+    nlohmann::json json = {{"name", "bob"}, {"upper", true}};
+
+    expect("parsed", renderData("page.html", root), "ann:X");
+    expect("json", registry->render("page.html", json), "bob:x");
+    expect("parsed after json", renderData("page.html", root), "ann:X");
+
+    registry->setCompiled("page.html");
+    expect("compiled", renderData("page.html", root), "exception: Lambdas aren't supported by compiled templates");
+    expect("json compiled", registry->render("page.html", json), "bob:x");
+
+    registry->setCompiled("page.html", false);
+    expect("parsed after setCompiled false", renderData("page.html", root), "ann:X");
+    expect("json after setCompiled false", registry->render("page.html", json), "bob:x");
+
+    // a partial of a parsed template comes from the data, of a compiled one from the files
+    std::ofstream(page) << "{{>part}}";
+    registry->invalidate("page.html");
+    data partial_root;
+    partial_root.set("part", partial([]() {
+        return std::string("data");
+    }));
+    expect("partial", renderData("page.html", partial_root), "data");
+    registry->setCompiled("page.html");
+    expect("compiled partial", renderData("page.html", partial_root), "file");
+    registry->setCompiled("page.html", false);
+    expect("partial after setCompiled false", renderData("page.html", partial_root), "data");
+
+    unlink(page.c_str());
+    unlink(part.c_str());
+    rmdir(directory);
+
+    if (failures != 0) {
+        std::cerr << failures << " renders are wrong" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "TemplateRegistryTest: parsed and compiled renders of one template are kept apart" << std::endl;
+    return EXIT_SUCCESS;
+}